@@ -48,9 +48,15 @@ MMGParams<MMGString> MMGActionCollections::collection_params {
 	.bounds = {},
 };
 
-MMGActionCollections::MMGActionCollections(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGAction(parent, json_obj),
+MMGActionCollections::Fields::Fields(const QJsonObject &json_obj)
+	: MMGAction::Fields(json_obj),
 	  collection(json_obj, "collection")
+{
+}
+
+MMGActionCollections::MMGActionCollections(MMGActionManager *parent, Fields &&fields)
+	: MMGAction(parent, fields),
+	  collection(std::move(fields.collection))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -97,12 +103,10 @@ void MMGActionCollections::execute(const MMGMappingTest &test) const
 	blog(LOG_DEBUG, "Successfully executed.");
 }
 
-void MMGActionCollections::processEvent(obs_frontend_event event) const
+void MMGActionCollections::processEvent(const MMGSignal::MMGFrontendState &state) const
 {
-	if (event != OBS_FRONTEND_EVENT_SCENE_COLLECTION_CHANGED) return;
-
 	EventFulfillment fulfillment(this);
-	fulfillment->addAcceptable(collection, currentCollection());
+	fulfillment->addAcceptable(collection, state.collection());
 }
 
 } // namespace MMGActions
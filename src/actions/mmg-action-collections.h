@@ -28,12 +28,18 @@ class MMGActionCollections : public MMGAction, public MMGSignal::MMGFrontendRece
 	Q_OBJECT
 
 public:
-	MMGActionCollections(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGAction::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGStringID collection;
+	};
+
+	MMGActionCollections(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x2101); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *categoryName() const override { return "Collections"; };
-	const char *trActionName() const override { return "ChangeState"; };
+	static constexpr const char *categoryName() { return "Collections"; };
+	static constexpr const char *trActionName() { return "ChangeState"; };
 
 	void initOldData(const QJsonObject &json_obj) override;
 	void json(QJsonObject &json_obj) const override;
@@ -44,7 +50,11 @@ public:
 private:
 	void execute(const MMGMappingTest &test) const override;
 	void connectSignal(bool connect) override { MMGSignal::connectMMGSignal(this, connect); };
-	void processEvent(obs_frontend_event event) const override;
+	QList<obs_frontend_event> frontendEvents() const override
+	{
+		return {OBS_FRONTEND_EVENT_SCENE_COLLECTION_CHANGED};
+	};
+	void processEvent(const MMGSignal::MMGFrontendState &state) const override;
 
 private:
 	MMGStringID collection;
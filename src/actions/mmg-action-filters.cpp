@@ -18,10 +18,11 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 
 #include "mmg-action-filters.h"
 #include "mmg-action-scenes.h"
+#include "../mmg-obs-catalog.h"
 
 namespace MMGActions {
 
-const MMGStringTranslationMap enumerateFilters(const MMGString &source_uuid)
+static MMGStringTranslationMap buildFilters(const MMGString &source_uuid)
 {
 	MMGStringTranslationMap map;
 	OBSSourceAutoRelease obs_source = obs_get_source_by_uuid(source_uuid);
@@ -37,7 +38,13 @@ const MMGStringTranslationMap enumerateFilters(const MMGString &source_uuid)
 	return map;
 }
 
-const MMGStringTranslationMap enumerateSourcesWithFilters()
+const MMGStringTranslationMap enumerateFilters(const MMGString &source_uuid)
+{
+	return MMGOBSCatalog::lookup(MMGOBSCatalog::FILTERS, source_uuid.value(),
+				     [&]() { return buildFilters(source_uuid); });
+}
+
+static MMGStringTranslationMap buildSourcesWithFilters()
 {
 	MMGStringTranslationMap map;
 
@@ -56,6 +63,11 @@ const MMGStringTranslationMap enumerateSourcesWithFilters()
 	return map;
 }
 
+const MMGStringTranslationMap enumerateSourcesWithFilters()
+{
+	return MMGOBSCatalog::lookup(MMGOBSCatalog::SOURCES_WITH_FILTERS, {}, buildSourcesWithFilters);
+}
+
 // MMGActionFilters
 MMGParams<MMGString> MMGActionFilters::source_params {
 	.desc = obstr("Basic.Main.Source"),
@@ -72,10 +84,17 @@ MMGParams<MMGString> MMGActionFilters::filter_params {
 	.bounds = {},
 };
 
-MMGActionFilters::MMGActionFilters(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGAction(parent, json_obj),
+MMGActionFilters::Fields::Fields(const QJsonObject &json_obj)
+	: MMGAction::Fields(json_obj),
 	  source(json_obj, "source"),
 	  filter(json_obj, "filter")
+{
+}
+
+MMGActionFilters::MMGActionFilters(MMGActionManager *parent, Fields &&fields)
+	: MMGAction(parent, fields),
+	  source(std::move(fields.source)),
+	  filter(std::move(fields.filter))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -130,7 +149,7 @@ void MMGActionFilters::onFilterChanged() const
 
 void MMGActionFilters::execute(const MMGMappingTest &test) const
 {
-	OBSSourceAutoRelease obs_filter = obs_get_source_by_uuid(MMGString(filter));
+	OBSSourceAutoRelease obs_filter = filter_target.get(filter);
 	ACTION_ASSERT(obs_filter, "The specified filter does not exist. Check the "
 				  "Filter field and try again.");
 
@@ -140,10 +159,10 @@ void MMGActionFilters::execute(const MMGMappingTest &test) const
 void MMGActionFilters::processEvent(const calldata_t *cd) const
 {
 	obs_source_t *signal_source = (obs_source_t *)(calldata_ptr(cd, "source"));
-	current_uuid = obs_source_get_uuid(signal_source);
+	const MMGString &source_uuid = source;
 
-	if (current_uuid == source) {
-		OBSSourceAutoRelease obs_filter = obs_get_source_by_uuid(MMGString(filter));
+	if (source_uuid == obs_source_get_uuid(signal_source)) {
+		OBSSourceAutoRelease obs_filter = filter_target.get(filter);
 		processEvent(obs_filter);
 	} else {
 		processEvent(signal_source);
@@ -158,9 +177,15 @@ MMGParams<bool> MMGActionFiltersVisible::visible_params {
 	.default_value = true,
 };
 
-MMGActionFiltersVisible::MMGActionFiltersVisible(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGActionFilters(parent, json_obj),
+MMGActionFiltersVisible::Fields::Fields(const QJsonObject &json_obj)
+	: MMGActionFilters::Fields(json_obj),
 	  visible(json_obj, "visible")
+{
+}
+
+MMGActionFiltersVisible::MMGActionFiltersVisible(MMGActionManager *parent, Fields &&fields)
+	: MMGActionFilters(parent, std::move(fields)),
+	  visible(std::move(fields.visible))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -227,9 +252,15 @@ MMGParams<uint64_t> MMGActionFiltersReorder::reorder_params {
 	.incremental_bound = 1.0,
 };
 
-MMGActionFiltersReorder::MMGActionFiltersReorder(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGActionFilters(parent, json_obj),
+MMGActionFiltersReorder::Fields::Fields(const QJsonObject &json_obj)
+	: MMGActionFilters::Fields(json_obj),
 	  index(json_obj, "index")
+{
+}
+
+MMGActionFiltersReorder::MMGActionFiltersReorder(MMGActionManager *parent, Fields &&fields)
+	: MMGActionFilters(parent, std::move(fields)),
+	  index(std::move(fields.index))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -296,9 +327,15 @@ void MMGActionFiltersReorder::processEvent(const obs_source_t *obs_filter) const
 // End MMGActionFiltersReorder
 
 // MMGActionFiltersCustom
-MMGActionFiltersCustom::MMGActionFiltersCustom(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGActionFilters(parent, json_obj),
-	  custom_data(new MMGOBSFields::MMGOBSObject(this, sourceId(), json_obj))
+MMGActionFiltersCustom::Fields::Fields(const QJsonObject &json_obj)
+	: MMGActionFilters::Fields(json_obj),
+	  custom_json(json_obj)
+{
+}
+
+MMGActionFiltersCustom::MMGActionFiltersCustom(MMGActionManager *parent, Fields &&fields)
+	: MMGActionFilters(parent, std::move(fields)),
+	  custom_data(new MMGOBSFields::MMGOBSObject(this, sourceId(), fields.custom_json))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -29,11 +29,17 @@ class MMGActionFilters : public MMGAction, public MMGSignal::MMGSourceReceiver {
 	Q_OBJECT
 
 public:
-	MMGActionFilters(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGAction::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGStringID source;
+		MMGStringID filter;
+	};
+
+	MMGActionFilters(MMGActionManager *parent, Fields &&fields);
 	virtual ~MMGActionFilters() = default;
 
-	const char *categoryName() const final override { return "Filters"; };
-	virtual const char *trActionName() const override = 0;
+	static constexpr const char *categoryName() { return "Filters"; };
 
 	virtual MMGString sourceId() const override { return filter; };
 	virtual const char *sourceSignalName() const override = 0;
@@ -57,13 +63,14 @@ protected:
 	virtual void processEvent(const obs_source_t *obs_filter) const = 0;
 
 protected:
-	obs_source_t *sourceParent() const { return OBSSourceAutoRelease(obs_get_source_by_uuid((MMGString)source)); };
+	OBSSourceAutoRelease sourceParent() const { return parent_target.get(source); };
 
 private:
 	MMGStringID source;
 	MMGStringID filter;
 
-	mutable const char *current_uuid;
+	mutable MMGActions::MMGSourceTarget parent_target;
+	mutable MMGActions::MMGSourceTarget filter_target;
 
 	static MMGParams<MMGString> source_params;
 	static MMGParams<MMGString> filter_params;
@@ -73,11 +80,17 @@ class MMGActionFiltersVisible : public MMGActionFilters {
 	Q_OBJECT
 
 public:
-	MMGActionFiltersVisible(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGActionFilters::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGBoolean visible;
+	};
+
+	MMGActionFiltersVisible(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x1501); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *trActionName() const override { return "Visibility"; };
+	static constexpr const char *trActionName() { return "Visibility"; };
 
 	const char *sourceSignalName() const override { return "enable"; };
 
@@ -103,11 +116,17 @@ class MMGActionFiltersReorder : public MMGActionFilters {
 	Q_OBJECT
 
 public:
-	MMGActionFiltersReorder(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGActionFilters::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGValue<uint64_t> index;
+	};
+
+	MMGActionFiltersReorder(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x1581); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *trActionName() const override { return "Reorder"; };
+	static constexpr const char *trActionName() { return "Reorder"; };
 
 	MMGString sourceId() const override { return obs_source_get_uuid(sourceParent()); };
 	const char *sourceSignalName() const override { return "reorder_filters"; };
@@ -134,11 +153,17 @@ MMG_DECLARE_ACTION(MMGActionFiltersReorder);
 
 class MMGActionFiltersCustom : public MMGActionFilters {
 public:
-	MMGActionFiltersCustom(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGActionFilters::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		QJsonObject custom_json;
+	};
+
+	MMGActionFiltersCustom(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x15ff); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *trActionName() const override { return "Custom"; };
+	static constexpr const char *trActionName() { return "Custom"; };
 
 	const char *sourceSignalName() const override { return "update"; };
 
@@ -17,6 +17,7 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 */
 
 #include "mmg-action-hotkeys.h"
+#include "../mmg-obs-catalog.h"
 
 namespace MMGActions {
 
@@ -51,7 +52,7 @@ static const MMGString registerer(obs_hotkey_t *hotkey)
 #undef HOTKEY_REGISTERER_GET_NAME
 };
 
-const MMGStringTranslationMap enumerateHotkeys(const MMGString &category)
+static MMGStringTranslationMap buildHotkeys(const MMGString &category)
 {
 	struct MMGHotkeyEnumeration {
 		MMGString category;
@@ -72,7 +73,13 @@ const MMGStringTranslationMap enumerateHotkeys(const MMGString &category)
 	return req.list;
 }
 
-const MMGStringTranslationMap enumerateHotkeyCategories()
+const MMGStringTranslationMap enumerateHotkeys(const MMGString &category)
+{
+	return MMGOBSCatalog::lookup(MMGOBSCatalog::HOTKEYS, category.value(),
+				     [&]() { return buildHotkeys(category); });
+}
+
+static MMGStringTranslationMap buildHotkeyCategories()
 {
 	MMGStringTranslationMap list;
 
@@ -91,6 +98,11 @@ const MMGStringTranslationMap enumerateHotkeyCategories()
 	return list;
 }
 
+const MMGStringTranslationMap enumerateHotkeyCategories()
+{
+	return MMGOBSCatalog::lookup(MMGOBSCatalog::HOTKEY_CATEGORIES, {}, buildHotkeyCategories);
+}
+
 MMGParams<MMGString> MMGActionHotkeys::group_params {
 	.desc = mmgtr("Actions.Hotkeys.Group"),
 	.options = OPTION_NONE,
@@ -105,10 +117,17 @@ MMGParams<MMGString> MMGActionHotkeys::hotkey_params {
 	.bounds = {},
 };
 
-MMGActionHotkeys::MMGActionHotkeys(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGAction(parent, json_obj),
+MMGActionHotkeys::Fields::Fields(const QJsonObject &json_obj)
+	: MMGAction::Fields(json_obj),
 	  hotkey_group(json_obj, "hotkey_group"),
 	  hotkey(json_obj, "hotkey")
+{
+}
+
+MMGActionHotkeys::MMGActionHotkeys(MMGActionManager *parent, Fields &&fields)
+	: MMGAction(parent, fields),
+	  hotkey_group(std::move(fields.hotkey_group)),
+	  hotkey(std::move(fields.hotkey))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -145,7 +164,7 @@ void MMGActionHotkeys::createDisplay(MMGWidgets::MMGActionDisplay *display)
 
 	MMGActions::createActionField(display, &hotkey_group, &group_params,
 				      std::bind(&MMGActionHotkeys::onGroupChange, this));
-	MMGActions::createActionField(display, &hotkey, &hotkey_params);
+	MMGActions::createActionField(display, &hotkey, &hotkey_params, std::bind(&MMGAction::refreshRequested, this));
 }
 
 void MMGActionHotkeys::onGroupChange() const
@@ -186,26 +205,17 @@ void MMGActionHotkeys::execute(const MMGMappingTest &test) const
 	blog(LOG_DEBUG, "Successfully executed.");
 }
 
-void MMGActionHotkeys::processEvent(obs_hotkey_id id) const
+QList<MMGString> MMGActionHotkeys::hotkeyNames() const
 {
-	hotkey_req.found = false;
-	hotkey_req.id = id;
-
-	obs_enum_hotkeys(
-		[](void *param, obs_hotkey_id id, obs_hotkey_t *hotkey) {
-			auto _req = reinterpret_cast<Request *>(param);
-
-			if (id != _req->id) return true;
-
-			_req->found = true;
-			_req->name = obs_hotkey_get_name(hotkey);
-			return false;
-		},
-		&hotkey_req);
+	// Any other state can match more than one hotkey
+	if (hotkey->state() != STATE_FIXED) return {};
+	return {hotkey};
+}
 
+void MMGActionHotkeys::processEvent(obs_hotkey_id, const MMGString &name) const
+{
 	EventFulfillment fulfiller(this);
-	fulfiller->addCondition(hotkey_req.found);
-	fulfiller->addAcceptable(hotkey, hotkey_req.name);
+	fulfiller->addAcceptable(hotkey, name);
 }
 
 } // namespace MMGActions
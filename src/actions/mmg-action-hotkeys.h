@@ -28,12 +28,19 @@ class MMGActionHotkeys : public MMGAction, public MMGSignal::MMGHotkeyReceiver {
 	Q_OBJECT
 
 public:
-	MMGActionHotkeys(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGAction::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGStringID hotkey_group;
+		MMGStringID hotkey;
+	};
+
+	MMGActionHotkeys(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x1601); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *categoryName() const override { return "Hotkeys"; };
-	const char *trActionName() const override { return "Activate"; };
+	static constexpr const char *categoryName() { return "Hotkeys"; };
+	static constexpr const char *trActionName() { return "Activate"; };
 
 	void initOldData(const QJsonObject &json_obj) override;
 	void json(QJsonObject &json_obj) const override;
@@ -45,7 +52,8 @@ public:
 private:
 	void execute(const MMGMappingTest &test) const override;
 	void connectSignal(bool connect) override { MMGSignal::connectMMGSignal(this, connect); };
-	void processEvent(obs_hotkey_id id) const override;
+	QList<MMGString> hotkeyNames() const override;
+	void processEvent(obs_hotkey_id id, const MMGString &name) const override;
 
 private:
 	MMGStringID hotkey_group;
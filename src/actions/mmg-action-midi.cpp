@@ -24,17 +24,23 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 namespace MMGActions {
 
 // MMGActionMIDISend
-MMGActionMIDISend::MMGActionMIDISend(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGAction(parent, json_obj),
-	  messages(new MMGMessageManager(this, "messages"))
+MMGActionMIDISend::Fields::Fields(const QJsonObject &json_obj) : MMGAction::Fields(json_obj)
 {
-	if (!parent) return; // Guard for initial population of MMGActions::all_action_types
-
 	if (json_obj.contains("device")) {
-		messages->add(json_obj);
+		messages.push_back(MMGMessages::decodeMessage(json_obj));
 	} else {
-		messages->load(json_obj);
+		for (const QJsonValue &message_val : json_obj["messages"].toArray())
+			messages.push_back(MMGMessages::decodeMessage(message_val.toObject()));
 	}
+}
+
+MMGActionMIDISend::MMGActionMIDISend(MMGActionManager *parent, Fields &&fields)
+	: MMGAction(parent, fields),
+	  messages(new MMGMessageManager(this, "messages"))
+{
+	for (MMGMessages::Decoded &message : fields.messages)
+		messages->add(MMGMessages::generateMessage(messages, std::move(message)));
+	if (messages->size() < 1) messages->add();
 
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -53,9 +59,7 @@ void MMGActionMIDISend::copy(MMGAction *dest) const
 	auto casted = dynamic_cast<MMGActionMIDISend *>(dest);
 	if (!casted) return;
 
-	casted->messages->clear();
-	for (MMGMessage *message : *messages)
-		message->copy(casted->messages->add());
+	messages->copy(casted->messages);
 }
 
 void MMGActionMIDISend::createDisplay(MMGWidgets::MMGActionDisplay *display)
@@ -94,11 +98,19 @@ static MMGParams<bool> out_status_params {
 	.default_value = true,
 };
 
-MMGActionMIDIConnection::MMGActionMIDIConnection(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGAction(parent, json_obj),
+MMGActionMIDIConnection::Fields::Fields(const QJsonObject &json_obj)
+	: MMGAction::Fields(json_obj),
 	  _device(json_obj, "device"),
 	  in_status(json_obj, "in_status"),
 	  out_status(json_obj, "out_status")
+{
+}
+
+MMGActionMIDIConnection::MMGActionMIDIConnection(MMGActionManager *parent, Fields &&fields)
+	: MMGAction(parent, fields),
+	  _device(std::move(fields._device)),
+	  in_status(std::move(fields.in_status)),
+	  out_status(std::move(fields.out_status))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
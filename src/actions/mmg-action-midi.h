@@ -20,6 +20,8 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 #include "../messages/mmg-message.h"
 #include "mmg-action.h"
 
+#include <vector>
+
 class MMGDevice;
 
 namespace MMGActions {
@@ -28,12 +30,18 @@ class MMGActionMIDISend : public MMGAction {
 	Q_OBJECT
 
 public:
-	MMGActionMIDISend(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGAction::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		std::vector<MMGMessages::Decoded> messages;
+	};
+
+	MMGActionMIDISend(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0xf001); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *categoryName() const override { return "MIDI"; };
-	const char *trActionName() const override { return "Input.Message"; };
+	static constexpr const char *categoryName() { return "MIDI"; };
+	static constexpr const char *trActionName() { return "Input.Message"; };
 
 	void json(QJsonObject &json_obj) const override;
 	void copy(MMGAction *dest) const override;
@@ -54,12 +62,20 @@ class MMGActionMIDIConnection : public MMGAction {
 	Q_OBJECT
 
 public:
-	MMGActionMIDIConnection(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGAction::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGStringID _device;
+		MMGBoolean in_status;
+		MMGBoolean out_status;
+	};
+
+	MMGActionMIDIConnection(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0xf011); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *categoryName() const override { return "MIDI"; };
-	const char *trActionName() const override { return "Connection"; };
+	static constexpr const char *categoryName() { return "MIDI"; };
+	static constexpr const char *trActionName() { return "Connection"; };
 
 	MMGDevice *device() const;
 
@@ -20,7 +20,7 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 
 namespace MMGActions {
 
-MMGActionNone::MMGActionNone(MMGActionManager *parent, const QJsonObject &json_obj) : MMGAction(parent, json_obj)
+MMGActionNone::MMGActionNone(MMGActionManager *parent, Fields &&fields) : MMGAction(parent, fields)
 {
 	blog(LOG_DEBUG, "Action created.");
 }
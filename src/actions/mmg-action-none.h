@@ -25,12 +25,12 @@ class MMGActionNone : public MMGAction {
 	Q_OBJECT
 
 public:
-	MMGActionNone(MMGActionManager *parent, const QJsonObject &json_obj);
+	MMGActionNone(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x0000); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *categoryName() const final override { return "None"; };
-	const char *trActionName() const final override { return "None"; };
+	static constexpr const char *categoryName() { return "None"; };
+	static constexpr const char *trActionName() { return "None"; };
 
 private:
 	void execute(const MMGMappingTest &) const override { blog(LOG_DEBUG, "Successfully executed."); };
@@ -48,9 +48,15 @@ MMGParams<MMGString> MMGActionProfiles::profile_params {
 	.bounds = {},
 };
 
-MMGActionProfiles::MMGActionProfiles(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGAction(parent, json_obj),
+MMGActionProfiles::Fields::Fields(const QJsonObject &json_obj)
+	: MMGAction::Fields(json_obj),
 	  profile(json_obj, "profile")
+{
+}
+
+MMGActionProfiles::MMGActionProfiles(MMGActionManager *parent, Fields &&fields)
+	: MMGAction(parent, fields),
+	  profile(std::move(fields.profile))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -101,12 +107,10 @@ void MMGActionProfiles::execute(const MMGMappingTest &test) const
 	blog(LOG_DEBUG, "Successfully executed.");
 }
 
-void MMGActionProfiles::processEvent(obs_frontend_event event) const
+void MMGActionProfiles::processEvent(const MMGSignal::MMGFrontendState &state) const
 {
-	if (event != OBS_FRONTEND_EVENT_PROFILE_CHANGED) return;
-
 	EventFulfillment fulfiller(this);
-	fulfiller->addAcceptable(profile, currentProfile());
+	fulfiller->addAcceptable(profile, state.profile());
 }
 
 } // namespace MMGActions
@@ -28,12 +28,18 @@ class MMGActionProfiles : public MMGAction, public MMGSignal::MMGFrontendReceive
 	Q_OBJECT
 
 public:
-	MMGActionProfiles(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGAction::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGStringID profile;
+	};
+
+	MMGActionProfiles(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x2001); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *categoryName() const override { return "Profiles"; };
-	const char *trActionName() const override { return "ChangeState"; };
+	static constexpr const char *categoryName() { return "Profiles"; };
+	static constexpr const char *trActionName() { return "ChangeState"; };
 
 	void initOldData(const QJsonObject &json_obj) override;
 	void json(QJsonObject &json_obj) const override;
@@ -44,7 +50,8 @@ public:
 private:
 	void execute(const MMGMappingTest &test) const override;
 	void connectSignal(bool connect) override { MMGSignal::connectMMGSignal(this, connect); };
-	void processEvent(obs_frontend_event event) const override;
+	QList<obs_frontend_event> frontendEvents() const override { return {OBS_FRONTEND_EVENT_PROFILE_CHANGED}; };
+	void processEvent(const MMGSignal::MMGFrontendState &state) const override;
 
 private:
 	MMGStringID profile;
@@ -27,9 +27,15 @@ const MMGParams<bool> MMGActionRecordRunState::record_params {
 	.default_value = true,
 };
 
-MMGActionRecordRunState::MMGActionRecordRunState(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGAction(parent, json_obj),
+MMGActionRecordRunState::Fields::Fields(const QJsonObject &json_obj)
+	: MMGAction::Fields(json_obj),
 	  record_state(json_obj, "record_state")
+{
+}
+
+MMGActionRecordRunState::MMGActionRecordRunState(MMGActionManager *parent, Fields &&fields)
+	: MMGAction(parent, fields),
+	  record_state(std::move(fields.record_state))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -78,10 +84,10 @@ void MMGActionRecordRunState::execute(const MMGMappingTest &test) const
 	blog(LOG_DEBUG, "Successfully executed.");
 }
 
-void MMGActionRecordRunState::processEvent(obs_frontend_event event) const
+void MMGActionRecordRunState::processEvent(const MMGSignal::MMGFrontendState &state) const
 {
 	EventFulfillment fulfiller(this);
-	fulfiller->addAcceptable(record_state, event, OBS_FRONTEND_EVENT_RECORDING_STARTED,
+	fulfiller->addAcceptable(record_state, state.event(), OBS_FRONTEND_EVENT_RECORDING_STARTED,
 				 OBS_FRONTEND_EVENT_RECORDING_STOPPED);
 }
 // End MMGActionRecordRunState
@@ -93,9 +99,15 @@ const MMGParams<bool> MMGActionRecordPauseState::pause_params {
 	.default_value = true,
 };
 
-MMGActionRecordPauseState::MMGActionRecordPauseState(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGAction(parent, json_obj),
+MMGActionRecordPauseState::Fields::Fields(const QJsonObject &json_obj)
+	: MMGAction::Fields(json_obj),
 	  pause_state(json_obj, "pause_state")
+{
+}
+
+MMGActionRecordPauseState::MMGActionRecordPauseState(MMGActionManager *parent, Fields &&fields)
+	: MMGAction(parent, fields),
+	  pause_state(std::move(fields.pause_state))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -143,10 +155,10 @@ void MMGActionRecordPauseState::execute(const MMGMappingTest &test) const
 	blog(LOG_DEBUG, "Successfully executed.");
 }
 
-void MMGActionRecordPauseState::processEvent(obs_frontend_event event) const
+void MMGActionRecordPauseState::processEvent(const MMGSignal::MMGFrontendState &state) const
 {
 	EventFulfillment fulfiller(this);
-	fulfiller->addAcceptable(pause_state, event, OBS_FRONTEND_EVENT_RECORDING_PAUSED,
+	fulfiller->addAcceptable(pause_state, state.event(), OBS_FRONTEND_EVENT_RECORDING_PAUSED,
 				 OBS_FRONTEND_EVENT_RECORDING_UNPAUSED);
 }
 // End MMGActionRecordPauseState
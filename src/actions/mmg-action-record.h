@@ -25,12 +25,18 @@ class MMGActionRecordRunState : public MMGAction, public MMGSignal::MMGFrontendR
 	Q_OBJECT
 
 public:
-	MMGActionRecordRunState(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGAction::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGBoolean record_state;
+	};
+
+	MMGActionRecordRunState(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x0201); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *categoryName() const override { return "Recording"; };
-	const char *trActionName() const override { return "ChangeState"; };
+	static constexpr const char *categoryName() { return "Recording"; };
+	static constexpr const char *trActionName() { return "ChangeState"; };
 
 	void initOldData(const QJsonObject &json_obj) override;
 	void json(QJsonObject &json_obj) const override;
@@ -41,7 +47,11 @@ public:
 private:
 	void execute(const MMGMappingTest &test) const override;
 	void connectSignal(bool connect) override { MMGSignal::connectMMGSignal(this, connect); };
-	void processEvent(obs_frontend_event event) const override;
+	QList<obs_frontend_event> frontendEvents() const override
+	{
+		return {OBS_FRONTEND_EVENT_RECORDING_STARTED, OBS_FRONTEND_EVENT_RECORDING_STOPPED};
+	};
+	void processEvent(const MMGSignal::MMGFrontendState &state) const override;
 
 private:
 	MMGBoolean record_state;
@@ -54,12 +64,18 @@ class MMGActionRecordPauseState : public MMGAction, public MMGSignal::MMGFronten
 	Q_OBJECT
 
 public:
-	MMGActionRecordPauseState(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGAction::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGBoolean pause_state;
+	};
+
+	MMGActionRecordPauseState(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x0281); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *categoryName() const override { return "Recording"; };
-	const char *trActionName() const override { return "PauseState"; };
+	static constexpr const char *categoryName() { return "Recording"; };
+	static constexpr const char *trActionName() { return "PauseState"; };
 
 	void initOldData(const QJsonObject &json_obj) override;
 	void json(QJsonObject &json_obj) const override;
@@ -70,7 +86,11 @@ public:
 private:
 	void execute(const MMGMappingTest &test) const override;
 	void connectSignal(bool connect) override { MMGSignal::connectMMGSignal(this, connect); };
-	void processEvent(obs_frontend_event event) const override;
+	QList<obs_frontend_event> frontendEvents() const override
+	{
+		return {OBS_FRONTEND_EVENT_RECORDING_PAUSED, OBS_FRONTEND_EVENT_RECORDING_UNPAUSED};
+	};
+	void processEvent(const MMGSignal::MMGFrontendState &state) const override;
 
 private:
 	MMGBoolean pause_state;
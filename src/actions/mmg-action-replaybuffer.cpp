@@ -39,9 +39,15 @@ const MMGParams<bool> MMGActionReplayBufferRunState::repbuf_params {
 	.default_value = true,
 };
 
-MMGActionReplayBufferRunState::MMGActionReplayBufferRunState(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGAction(parent, json_obj),
+MMGActionReplayBufferRunState::Fields::Fields(const QJsonObject &json_obj)
+	: MMGAction::Fields(json_obj),
 	  repbuf_state(json_obj, "repbuf_state")
+{
+}
+
+MMGActionReplayBufferRunState::MMGActionReplayBufferRunState(MMGActionManager *parent, Fields &&fields)
+	: MMGAction(parent, fields),
+	  repbuf_state(std::move(fields.repbuf_state))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -92,17 +98,17 @@ void MMGActionReplayBufferRunState::execute(const MMGMappingTest &test) const
 	blog(LOG_DEBUG, "Successfully executed.");
 }
 
-void MMGActionReplayBufferRunState::processEvent(obs_frontend_event event) const
+void MMGActionReplayBufferRunState::processEvent(const MMGSignal::MMGFrontendState &state) const
 {
 	EventFulfillment fulfiller(this);
-	fulfiller->addAcceptable(repbuf_state, event, OBS_FRONTEND_EVENT_REPLAY_BUFFER_STARTED,
+	fulfiller->addAcceptable(repbuf_state, state.event(), OBS_FRONTEND_EVENT_REPLAY_BUFFER_STARTED,
 				 OBS_FRONTEND_EVENT_REPLAY_BUFFER_STOPPED);
 }
 // End MMGActionReplayBufferRunState
 
 // MMGActionReplayBufferSave
-MMGActionReplayBufferSave::MMGActionReplayBufferSave(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGAction(parent, json_obj)
+MMGActionReplayBufferSave::MMGActionReplayBufferSave(MMGActionManager *parent, Fields &&fields)
+	: MMGAction(parent, fields)
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -25,12 +25,18 @@ class MMGActionReplayBufferRunState : public MMGAction, public MMGSignal::MMGFro
 	Q_OBJECT
 
 public:
-	MMGActionReplayBufferRunState(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGAction::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGBoolean repbuf_state;
+	};
+
+	MMGActionReplayBufferRunState(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x0401); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *categoryName() const override { return "ReplayBuffer"; };
-	const char *trActionName() const override { return "ChangeState"; };
+	static constexpr const char *categoryName() { return "ReplayBuffer"; };
+	static constexpr const char *trActionName() { return "ChangeState"; };
 
 	void initOldData(const QJsonObject &json_obj) override;
 	void json(QJsonObject &json_obj) const override;
@@ -41,7 +47,11 @@ public:
 private:
 	void execute(const MMGMappingTest &test) const override;
 	void connectSignal(bool connect) override { MMGSignal::connectMMGSignal(this, connect); };
-	void processEvent(obs_frontend_event event) const override;
+	QList<obs_frontend_event> frontendEvents() const override
+	{
+		return {OBS_FRONTEND_EVENT_REPLAY_BUFFER_STARTED, OBS_FRONTEND_EVENT_REPLAY_BUFFER_STOPPED};
+	};
+	void processEvent(const MMGSignal::MMGFrontendState &state) const override;
 
 private:
 	MMGBoolean repbuf_state;
@@ -54,20 +64,18 @@ class MMGActionReplayBufferSave : public MMGAction, public MMGSignal::MMGFronten
 	Q_OBJECT
 
 public:
-	MMGActionReplayBufferSave(MMGActionManager *parent, const QJsonObject &json_obj);
+	MMGActionReplayBufferSave(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x0481); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *categoryName() const override { return "ReplayBuffer"; };
-	const char *trActionName() const override { return "Save"; };
+	static constexpr const char *categoryName() { return "ReplayBuffer"; };
+	static constexpr const char *trActionName() { return "Save"; };
 
 private:
 	void execute(const MMGMappingTest &) const override;
 	void connectSignal(bool connect) override { MMGSignal::connectMMGSignal(this, connect); };
-	void processEvent(obs_frontend_event event) const override
-	{
-		if (event == OBS_FRONTEND_EVENT_REPLAY_BUFFER_SAVED) EventFulfillment fulfiller(this);
-	};
+	QList<obs_frontend_event> frontendEvents() const override { return {OBS_FRONTEND_EVENT_REPLAY_BUFFER_SAVED}; };
+	void processEvent(const MMGSignal::MMGFrontendState &) const override { EventFulfillment fulfiller(this); };
 };
 MMG_DECLARE_ACTION(MMGActionReplayBufferSave);
 
@@ -18,6 +18,7 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 
 #include "mmg-action-scene-items.h"
 #include "mmg-action-scenes.h"
+#include "../mmg-preference-defs.h"
 
 vec2 &operator*=(vec2 &lhs, float rhs)
 {
@@ -52,6 +53,106 @@ const vec2 obsResolution()
 	return xy;
 }
 
+// MMGFrameTransforms
+QHash<obs_sceneitem_t *, MMGFrameTransforms::Pending> MMGFrameTransforms::pending;
+std::mutex MMGFrameTransforms::pending_mutex;
+
+void MMGFrameTransforms::init()
+{
+	obs_add_tick_callback(tick, nullptr);
+}
+
+void MMGFrameTransforms::release()
+{
+	obs_remove_tick_callback(tick, nullptr);
+
+	std::scoped_lock lock(pending_mutex);
+	for (obs_sceneitem_t *obs_sceneitem : pending.keys())
+		obs_sceneitem_release(obs_sceneitem);
+	pending.clear();
+}
+
+MMGFrameTransforms::Pending &MMGFrameTransforms::stage(obs_sceneitem_t *obs_sceneitem)
+{
+	// Staged items are kept alive until they are applied
+	if (!pending.contains(obs_sceneitem)) obs_sceneitem_addref(obs_sceneitem);
+	return pending[obs_sceneitem];
+}
+
+const MMGFrameTransforms::Pending *MMGFrameTransforms::staged(obs_sceneitem_t *obs_sceneitem)
+{
+	auto it = pending.constFind(obs_sceneitem);
+	return it != pending.constEnd() ? &*it : nullptr;
+}
+
+template <typename T, typename Read, typename Write>
+bool MMGFrameTransforms::update(obs_sceneitem_t *obs_sceneitem, std::optional<T> Pending::*transform, Read read,
+				Write write, const std::function<bool(T &)> &modify)
+{
+	std::scoped_lock lock(pending_mutex);
+
+	T value;
+	if (auto *item = staged(obs_sceneitem); !!item && item->*transform)
+		value = *(item->*transform);
+	else
+		read(obs_sceneitem, &value);
+
+	if (!modify(value)) return false;
+
+	if (MMGPreferences::MMGPreferenceGeneral::frameSyncTransforms())
+		stage(obs_sceneitem).*transform = value;
+	else
+		write(obs_sceneitem, &value);
+	return true;
+}
+
+bool MMGFrameTransforms::updatePos(obs_sceneitem_t *obs_sceneitem, const std::function<bool(vec2 &)> &modify)
+{
+	return update(obs_sceneitem, &Pending::pos, obs_sceneitem_get_pos, obs_sceneitem_set_pos, modify);
+}
+
+bool MMGFrameTransforms::updateScale(obs_sceneitem_t *obs_sceneitem, const std::function<bool(vec2 &)> &modify)
+{
+	return update(obs_sceneitem, &Pending::scale, obs_sceneitem_get_scale, obs_sceneitem_set_scale, modify);
+}
+
+bool MMGFrameTransforms::updateRot(obs_sceneitem_t *obs_sceneitem, const std::function<bool(float &)> &modify)
+{
+	return update(
+		obs_sceneitem, &Pending::rot,
+		[](obs_sceneitem_t *obs_sceneitem, float *rot) { *rot = obs_sceneitem_get_rot(obs_sceneitem); },
+		[](obs_sceneitem_t *obs_sceneitem, const float *rot) { obs_sceneitem_set_rot(obs_sceneitem, *rot); },
+		modify);
+}
+
+bool MMGFrameTransforms::updateCrop(obs_sceneitem_t *obs_sceneitem,
+				    const std::function<bool(obs_sceneitem_crop &)> &modify)
+{
+	return update(obs_sceneitem, &Pending::crop, obs_sceneitem_get_crop, obs_sceneitem_set_crop, modify);
+}
+
+void MMGFrameTransforms::tick(void *, float)
+{
+	QHash<obs_sceneitem_t *, Pending> applying;
+	{
+		std::scoped_lock lock(pending_mutex);
+		if (pending.isEmpty()) return;
+		applying.swap(pending);
+	}
+
+	for (auto [obs_sceneitem, item] : applying.asKeyValueRange()) {
+		obs_sceneitem_defer_update_begin(obs_sceneitem);
+		if (item.pos) obs_sceneitem_set_pos(obs_sceneitem, &*item.pos);
+		if (item.scale) obs_sceneitem_set_scale(obs_sceneitem, &*item.scale);
+		if (item.rot) obs_sceneitem_set_rot(obs_sceneitem, *item.rot);
+		if (item.crop) obs_sceneitem_set_crop(obs_sceneitem, &*item.crop);
+		obs_sceneitem_defer_update_end(obs_sceneitem);
+
+		obs_sceneitem_release(obs_sceneitem);
+	}
+}
+// End MMGFrameTransforms
+
 // MMGActionSceneItems
 MMGParams<MMGString> MMGActionSceneItems::source_params {
 	.desc = obstr("Basic.Main.Source"),
@@ -61,10 +162,17 @@ MMGParams<MMGString> MMGActionSceneItems::source_params {
 	.placeholder = mmgtr("Actions.SceneItems.Placeholder"),
 };
 
-MMGActionSceneItems::MMGActionSceneItems(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGAction(parent, json_obj),
+MMGActionSceneItems::Fields::Fields(const QJsonObject &json_obj)
+	: MMGAction::Fields(json_obj),
 	  scene(json_obj, "scene"),
 	  source(json_obj, "source")
+{
+}
+
+MMGActionSceneItems::MMGActionSceneItems(MMGActionManager *parent, Fields &&fields)
+	: MMGAction(parent, fields),
+	  scene(std::move(fields.scene)),
+	  source(std::move(fields.source))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -162,9 +270,15 @@ MMGParams<bool> MMGActionSceneItemsVisible::display_params {
 	.default_value = true,
 };
 
-MMGActionSceneItemsVisible::MMGActionSceneItemsVisible(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGActionSceneItems(parent, json_obj),
+MMGActionSceneItemsVisible::Fields::Fields(const QJsonObject &json_obj)
+	: MMGActionSceneItems::Fields(json_obj),
 	  disp(json_obj, "visible")
+{
+}
+
+MMGActionSceneItemsVisible::MMGActionSceneItemsVisible(MMGActionManager *parent, Fields &&fields)
+	: MMGActionSceneItems(parent, std::move(fields)),
+	  disp(std::move(fields.disp))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -230,9 +344,15 @@ MMGParams<bool> MMGActionSceneItemsLocked::lock_params {
 	.default_value = false,
 };
 
-MMGActionSceneItemsLocked::MMGActionSceneItemsLocked(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGActionSceneItems(parent, json_obj),
+MMGActionSceneItemsLocked::Fields::Fields(const QJsonObject &json_obj)
+	: MMGActionSceneItems::Fields(json_obj),
 	  lock(json_obj, "locked")
+{
+}
+
+MMGActionSceneItemsLocked::MMGActionSceneItemsLocked(MMGActionManager *parent, Fields &&fields)
+	: MMGActionSceneItems(parent, std::move(fields)),
+	  lock(std::move(fields.lock))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -315,10 +435,17 @@ MMGParams<float> MMGActionSceneItemsPosition::pos_y_params {
 	.incremental_bound = 5000.0,
 };
 
-MMGActionSceneItemsPosition::MMGActionSceneItemsPosition(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGActionSceneItems(parent, json_obj),
+MMGActionSceneItemsPosition::Fields::Fields(const QJsonObject &json_obj)
+	: MMGActionSceneItems::Fields(json_obj),
 	  pos_x(json_obj, "x"),
 	  pos_y(json_obj, "y")
+{
+}
+
+MMGActionSceneItemsPosition::MMGActionSceneItemsPosition(MMGActionManager *parent, Fields &&fields)
+	: MMGActionSceneItems(parent, std::move(fields)),
+	  pos_x(std::move(fields.pos_x)),
+	  pos_y(std::move(fields.pos_y))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -371,14 +498,15 @@ void MMGActionSceneItemsPosition::onSourceFixedChanged(const obs_sceneitem_t *ob
 
 void MMGActionSceneItemsPosition::execute(const MMGMappingTest &test, obs_sceneitem_t *obs_sceneitem) const
 {
-	obs_sceneitem_get_pos(obs_sceneitem, &current_pos);
-	ACTION_ASSERT(test.applicable(pos_x, current_pos.x),
-		      "An x-value could not be selected. Check the Position X field "
-		      "and try again.");
-	ACTION_ASSERT(test.applicable(pos_y, current_pos.y),
-		      "A y-value could not be selected. Check the Position Y field "
-		      "and try again.");
-	obs_sceneitem_set_pos(obs_sceneitem, &current_pos);
+	bool x_applied = false;
+	bool applied = MMGFrameTransforms::updatePos(obs_sceneitem, [&](vec2 &pos) {
+		x_applied = test.applicable(pos_x, pos.x);
+		return x_applied && test.applicable(pos_y, pos.y);
+	});
+	ACTION_ASSERT(x_applied, "An x-value could not be selected. Check the Position X field "
+				 "and try again.");
+	ACTION_ASSERT(applied, "A y-value could not be selected. Check the Position Y field "
+			       "and try again.");
 }
 
 void MMGActionSceneItemsPosition::processEvent(MMGMappingTest &test, const obs_sceneitem_t *obs_sceneitem) const
@@ -415,10 +543,17 @@ MMGParams<float> MMGActionSceneItemsScale::scale_y_params {
 	.incremental_bound = 1000.0,
 };
 
-MMGActionSceneItemsScale::MMGActionSceneItemsScale(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGActionSceneItems(parent, json_obj),
+MMGActionSceneItemsScale::Fields::Fields(const QJsonObject &json_obj)
+	: MMGActionSceneItems::Fields(json_obj),
 	  scale_x(json_obj, "x"),
 	  scale_y(json_obj, "y")
+{
+}
+
+MMGActionSceneItemsScale::MMGActionSceneItemsScale(MMGActionManager *parent, Fields &&fields)
+	: MMGActionSceneItems(parent, std::move(fields)),
+	  scale_x(std::move(fields.scale_x)),
+	  scale_y(std::move(fields.scale_y))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -481,16 +616,18 @@ void MMGActionSceneItemsScale::onSourceFixedChanged(const obs_sceneitem_t *obs_s
 
 void MMGActionSceneItemsScale::execute(const MMGMappingTest &test, obs_sceneitem_t *obs_sceneitem) const
 {
-	obs_sceneitem_get_scale(obs_sceneitem, &current_scale);
-	current_scale *= 100.0;
-	ACTION_ASSERT(test.applicable(scale_x, current_scale.x),
-		      "An x-value could not be selected. Check the Scale X field and "
-		      "try again.");
-	ACTION_ASSERT(test.applicable(scale_y, current_scale.y),
-		      "A y-value could not be selected. Check the Scale Y field and "
-		      "try again.");
-	current_scale /= 100.0;
-	obs_sceneitem_set_scale(obs_sceneitem, &current_scale);
+	bool x_applied = false;
+	bool applied = MMGFrameTransforms::updateScale(obs_sceneitem, [&](vec2 &scale) {
+		scale *= 100.0;
+		x_applied = test.applicable(scale_x, scale.x);
+		if (!x_applied || !test.applicable(scale_y, scale.y)) return false;
+		scale /= 100.0;
+		return true;
+	});
+	ACTION_ASSERT(x_applied, "An x-value could not be selected. Check the Scale X field and "
+				 "try again.");
+	ACTION_ASSERT(applied, "A y-value could not be selected. Check the Scale Y field and "
+			       "try again.");
 }
 
 void MMGActionSceneItemsScale::processEvent(MMGMappingTest &test, const obs_sceneitem_t *obs_sceneitem) const
@@ -515,9 +652,15 @@ MMGParams<float> MMGActionSceneItemsRotation::rotation_params {
 	.incremental_bound = 180.0,
 };
 
-MMGActionSceneItemsRotation::MMGActionSceneItemsRotation(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGActionSceneItems(parent, json_obj),
+MMGActionSceneItemsRotation::Fields::Fields(const QJsonObject &json_obj)
+	: MMGActionSceneItems::Fields(json_obj),
 	  rot(json_obj, "rot")
+{
+}
+
+MMGActionSceneItemsRotation::MMGActionSceneItemsRotation(MMGActionManager *parent, Fields &&fields)
+	: MMGActionSceneItems(parent, std::move(fields)),
+	  rot(std::move(fields.rot))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -564,10 +707,10 @@ void MMGActionSceneItemsRotation::onSourceFixedChanged(const obs_sceneitem_t *ob
 
 void MMGActionSceneItemsRotation::execute(const MMGMappingTest &test, obs_sceneitem_t *obs_sceneitem) const
 {
-	float rotation = obs_sceneitem_get_rot(obs_sceneitem);
-	ACTION_ASSERT(test.applicable(rot, rotation), "A rotation could not be selected. Check the Rotation field "
-						      "and try again.");
-	obs_sceneitem_set_rot(obs_sceneitem, rotation);
+	bool applied = MMGFrameTransforms::updateRot(obs_sceneitem,
+						     [&](float &rotation) { return test.applicable(rot, rotation); });
+	ACTION_ASSERT(applied, "A rotation could not be selected. Check the Rotation field "
+			       "and try again.");
 }
 
 void MMGActionSceneItemsRotation::processEvent(MMGMappingTest &test, const obs_sceneitem_t *obs_sceneitem) const
@@ -632,12 +775,21 @@ MMGParams<int32_t> MMGActionSceneItemsCrop::crop_params[4] {
 	},
 };
 
-MMGActionSceneItemsCrop::MMGActionSceneItemsCrop(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGActionSceneItems(parent, json_obj),
+MMGActionSceneItemsCrop::Fields::Fields(const QJsonObject &json_obj)
+	: MMGActionSceneItems::Fields(json_obj),
 	  crop_l(json_obj, "left"),
 	  crop_t(json_obj, "top"),
 	  crop_r(json_obj, "right"),
 	  crop_b(json_obj, "bottom")
+{
+}
+
+MMGActionSceneItemsCrop::MMGActionSceneItemsCrop(MMGActionManager *parent, Fields &&fields)
+	: MMGActionSceneItems(parent, std::move(fields)),
+	  crop_l(std::move(fields.crop_l)),
+	  crop_t(std::move(fields.crop_t)),
+	  crop_r(std::move(fields.crop_r)),
+	  crop_b(std::move(fields.crop_b))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -715,20 +867,23 @@ void MMGActionSceneItemsCrop::onSourceFixedChanged(const obs_sceneitem_t *obs_sc
 
 void MMGActionSceneItemsCrop::execute(const MMGMappingTest &test, obs_sceneitem_t *obs_sceneitem) const
 {
-	obs_sceneitem_get_crop(obs_sceneitem, &current_crop);
-	ACTION_ASSERT(test.applicable(crop_l, current_crop.left),
-		      "A crop element could not be selected. Check the Crop Left and "
-		      "try again.");
-	ACTION_ASSERT(test.applicable(crop_t, current_crop.top),
-		      "A crop element could not be selected. Check the Crop Top and "
-		      "try again.");
-	ACTION_ASSERT(test.applicable(crop_r, current_crop.right),
-		      "A crop element could not be selected. Check the Crop Right "
-		      "and try again.");
-	ACTION_ASSERT(test.applicable(crop_b, current_crop.bottom),
-		      "A crop element could not be selected. Check the Crop Bottom "
-		      "and try again.");
-	obs_sceneitem_set_crop(obs_sceneitem, &current_crop);
+	// Counts the elements applied before the first failure
+	int applied = 0;
+	MMGFrameTransforms::updateCrop(obs_sceneitem, [&](obs_sceneitem_crop &crop) {
+		if (test.applicable(crop_l, crop.left)) ++applied;
+		if (applied == 1 && test.applicable(crop_t, crop.top)) ++applied;
+		if (applied == 2 && test.applicable(crop_r, crop.right)) ++applied;
+		if (applied == 3 && test.applicable(crop_b, crop.bottom)) ++applied;
+		return applied == 4;
+	});
+	ACTION_ASSERT(applied > 0, "A crop element could not be selected. Check the Crop Left and "
+				   "try again.");
+	ACTION_ASSERT(applied > 1, "A crop element could not be selected. Check the Crop Top and "
+				   "try again.");
+	ACTION_ASSERT(applied > 2, "A crop element could not be selected. Check the Crop Right "
+				   "and try again.");
+	ACTION_ASSERT(applied > 3, "A crop element could not be selected. Check the Crop Bottom "
+				   "and try again.");
 }
 
 void MMGActionSceneItemsCrop::processEvent(MMGMappingTest &test, const obs_sceneitem_t *obs_sceneitem) const
@@ -763,9 +918,15 @@ MMGParams<Alignment> MMGActionSceneItemsAlignment::alignment_params {
 		},
 };
 
-MMGActionSceneItemsAlignment::MMGActionSceneItemsAlignment(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGActionSceneItems(parent, json_obj),
+MMGActionSceneItemsAlignment::Fields::Fields(const QJsonObject &json_obj)
+	: MMGActionSceneItems::Fields(json_obj),
 	  alignment(json_obj, "alignment")
+{
+}
+
+MMGActionSceneItemsAlignment::MMGActionSceneItemsAlignment(MMGActionManager *parent, Fields &&fields)
+	: MMGActionSceneItems(parent, std::move(fields)),
+	  alignment(std::move(fields.alignment))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -845,9 +1006,15 @@ MMGParams<obs_scale_type> MMGActionSceneItemsScaleFilter::scale_filter_params {
 		},
 };
 
-MMGActionSceneItemsScaleFilter::MMGActionSceneItemsScaleFilter(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGActionSceneItems(parent, json_obj),
+MMGActionSceneItemsScaleFilter::Fields::Fields(const QJsonObject &json_obj)
+	: MMGActionSceneItems::Fields(json_obj),
 	  scale_filter(json_obj, "scale_filter")
+{
+}
+
+MMGActionSceneItemsScaleFilter::MMGActionSceneItemsScaleFilter(MMGActionManager *parent, Fields &&fields)
+	: MMGActionSceneItems(parent, std::move(fields)),
+	  scale_filter(std::move(fields.scale_filter))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -930,9 +1097,15 @@ MMGParams<obs_blending_type> MMGActionSceneItemsBlendingMode::blending_mode_para
 		},
 };
 
-MMGActionSceneItemsBlendingMode::MMGActionSceneItemsBlendingMode(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGActionSceneItems(parent, json_obj),
+MMGActionSceneItemsBlendingMode::Fields::Fields(const QJsonObject &json_obj)
+	: MMGActionSceneItems::Fields(json_obj),
 	  blending_mode(json_obj, "blending_mode")
+{
+}
+
+MMGActionSceneItemsBlendingMode::MMGActionSceneItemsBlendingMode(MMGActionManager *parent, Fields &&fields)
+	: MMGActionSceneItems(parent, std::move(fields)),
+	  blending_mode(std::move(fields.blending_mode))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -1015,10 +1188,15 @@ MMGParams<obs_bounds_type> MMGActionSceneItemsBoundingBoxType::bounds_type_param
 		},
 };
 
-MMGActionSceneItemsBoundingBoxType::MMGActionSceneItemsBoundingBoxType(MMGActionManager *parent,
-								       const QJsonObject &json_obj)
-	: MMGActionSceneItems(parent, json_obj),
+MMGActionSceneItemsBoundingBoxType::Fields::Fields(const QJsonObject &json_obj)
+	: MMGActionSceneItems::Fields(json_obj),
 	  bounds_type(json_obj, "bounds_type")
+{
+}
+
+MMGActionSceneItemsBoundingBoxType::MMGActionSceneItemsBoundingBoxType(MMGActionManager *parent, Fields &&fields)
+	: MMGActionSceneItems(parent, std::move(fields)),
+	  bounds_type(std::move(fields.bounds_type))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -1105,11 +1283,17 @@ MMGParams<float> MMGActionSceneItemsBoundingBoxSize::bounds_y_params {
 	.incremental_bound = 5000.0,
 };
 
-MMGActionSceneItemsBoundingBoxSize::MMGActionSceneItemsBoundingBoxSize(MMGActionManager *parent,
-								       const QJsonObject &json_obj)
-	: MMGActionSceneItems(parent, json_obj),
+MMGActionSceneItemsBoundingBoxSize::Fields::Fields(const QJsonObject &json_obj)
+	: MMGActionSceneItems::Fields(json_obj),
 	  bounds_x(json_obj, "x"),
 	  bounds_y(json_obj, "y")
+{
+}
+
+MMGActionSceneItemsBoundingBoxSize::MMGActionSceneItemsBoundingBoxSize(MMGActionManager *parent, Fields &&fields)
+	: MMGActionSceneItems(parent, std::move(fields)),
+	  bounds_x(std::move(fields.bounds_x)),
+	  bounds_y(std::move(fields.bounds_y))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -1184,10 +1368,16 @@ void MMGActionSceneItemsBoundingBoxSize::processEvent(MMGMappingTest &test, cons
 // End MMGActionSceneItemsBoundingBoxSize
 
 // MMGActionSceneItemsBoundingBoxAlignment
-MMGActionSceneItemsBoundingBoxAlignment::MMGActionSceneItemsBoundingBoxAlignment(MMGActionManager *parent,
-										 const QJsonObject &json_obj)
-	: MMGActionSceneItems(parent, json_obj),
+MMGActionSceneItemsBoundingBoxAlignment::Fields::Fields(const QJsonObject &json_obj)
+	: MMGActionSceneItems::Fields(json_obj),
 	  alignment(json_obj, "alignment")
+{
+}
+
+MMGActionSceneItemsBoundingBoxAlignment::MMGActionSceneItemsBoundingBoxAlignment(MMGActionManager *parent,
+										 Fields &&fields)
+	: MMGActionSceneItems(parent, std::move(fields)),
+	  alignment(std::move(fields.alignment))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
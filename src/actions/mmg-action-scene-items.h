@@ -19,6 +19,9 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 #pragma once
 #include "mmg-action.h"
 
+#include <mutex>
+#include <optional>
+
 namespace MMGActions {
 
 enum Alignment {
@@ -33,15 +36,53 @@ enum Alignment {
 	OBS_ALIGN_BOTTOM_RIGHT = OBS_ALIGN_BOTTOM | OBS_ALIGN_RIGHT,
 };
 
+// Transforms staged here are applied together on the next video tick (if enabled),
+// so that each scene item is only updated once per frame
+class MMGFrameTransforms {
+public:
+	static void init();
+	static void release();
+
+	// Each reads, modifies and writes under one lock, so concurrent changes to the same item build on each other
+	static bool updatePos(obs_sceneitem_t *obs_sceneitem, const std::function<bool(vec2 &)> &modify);
+	static bool updateScale(obs_sceneitem_t *obs_sceneitem, const std::function<bool(vec2 &)> &modify);
+	static bool updateRot(obs_sceneitem_t *obs_sceneitem, const std::function<bool(float &)> &modify);
+	static bool updateCrop(obs_sceneitem_t *obs_sceneitem, const std::function<bool(obs_sceneitem_crop &)> &modify);
+
+private:
+	struct Pending {
+		std::optional<vec2> pos;
+		std::optional<vec2> scale;
+		std::optional<float> rot;
+		std::optional<obs_sceneitem_crop> crop;
+	};
+
+	static Pending &stage(obs_sceneitem_t *obs_sceneitem);
+	static const Pending *staged(obs_sceneitem_t *obs_sceneitem);
+	template <typename T, typename Read, typename Write>
+	static bool update(obs_sceneitem_t *obs_sceneitem, std::optional<T> Pending::*transform, Read read, Write write,
+			   const std::function<bool(T &)> &modify);
+	static void tick(void *, float);
+
+	static QHash<obs_sceneitem_t *, Pending> pending;
+	static std::mutex pending_mutex;
+};
+
 class MMGActionSceneItems : public MMGAction, public MMGSignal::MMGSourceReceiver {
 	Q_OBJECT
 
 public:
-	MMGActionSceneItems(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGAction::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGStringID scene;
+		MMGStringID source;
+	};
+
+	MMGActionSceneItems(MMGActionManager *parent, Fields &&fields);
 	virtual ~MMGActionSceneItems() = default;
 
-	const char *categoryName() const final override { return "SceneItems"; };
-	virtual const char *trActionName() const override = 0;
+	static constexpr const char *categoryName() { return "SceneItems"; };
 
 	MMGString sourceId() const final override;
 	virtual const char *sourceSignalName() const override = 0;
@@ -82,11 +123,17 @@ class MMGActionSceneItemsVisible : public MMGActionSceneItems {
 	Q_OBJECT
 
 public:
-	MMGActionSceneItemsVisible(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGActionSceneItems::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGBoolean disp;
+	};
+
+	MMGActionSceneItemsVisible(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x1201); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *trActionName() const override { return "Display"; };
+	static constexpr const char *trActionName() { return "Display"; };
 
 	const char *sourceSignalName() const override { return "item_visible"; };
 
@@ -112,11 +159,17 @@ class MMGActionSceneItemsLocked : public MMGActionSceneItems {
 	Q_OBJECT
 
 public:
-	MMGActionSceneItemsLocked(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGActionSceneItems::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGBoolean lock;
+	};
+
+	MMGActionSceneItemsLocked(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x1202); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *trActionName() const override { return "Locking"; };
+	static constexpr const char *trActionName() { return "Locking"; };
 
 	const char *sourceSignalName() const override { return "item_locked"; };
 
@@ -142,11 +195,18 @@ class MMGActionSceneItemsPosition : public MMGActionSceneItems {
 	Q_OBJECT
 
 public:
-	MMGActionSceneItemsPosition(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGActionSceneItems::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGFloat pos_x;
+		MMGFloat pos_y;
+	};
+
+	MMGActionSceneItemsPosition(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x1211); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *trActionName() const override { return "Move"; };
+	static constexpr const char *trActionName() { return "Move"; };
 
 	const char *sourceSignalName() const override { return "item_transform"; };
 
@@ -176,11 +236,18 @@ class MMGActionSceneItemsScale : public MMGActionSceneItems {
 	Q_OBJECT
 
 public:
-	MMGActionSceneItemsScale(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGActionSceneItems::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGFloat scale_x;
+		MMGFloat scale_y;
+	};
+
+	MMGActionSceneItemsScale(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x1212); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *trActionName() const override { return "Scale"; };
+	static constexpr const char *trActionName() { return "Scale"; };
 
 	const char *sourceSignalName() const override { return "item_transform"; };
 
@@ -210,11 +277,17 @@ class MMGActionSceneItemsRotation : public MMGActionSceneItems {
 	Q_OBJECT
 
 public:
-	MMGActionSceneItemsRotation(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGActionSceneItems::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGFloat rot;
+	};
+
+	MMGActionSceneItemsRotation(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x1213); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *trActionName() const override { return "Rotate"; };
+	static constexpr const char *trActionName() { return "Rotate"; };
 
 	const char *sourceSignalName() const override { return "item_transform"; };
 
@@ -242,11 +315,20 @@ class MMGActionSceneItemsCrop : public MMGActionSceneItems {
 	Q_OBJECT
 
 public:
-	MMGActionSceneItemsCrop(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGActionSceneItems::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGInteger crop_l;
+		MMGInteger crop_t;
+		MMGInteger crop_r;
+		MMGInteger crop_b;
+	};
+
+	MMGActionSceneItemsCrop(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x1214); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *trActionName() const override { return "Crop"; };
+	static constexpr const char *trActionName() { return "Crop"; };
 
 	const char *sourceSignalName() const override { return "item_transform"; };
 
@@ -277,11 +359,17 @@ class MMGActionSceneItemsAlignment : public MMGActionSceneItems {
 	Q_OBJECT
 
 public:
-	MMGActionSceneItemsAlignment(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGActionSceneItems::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGValue<Alignment> alignment;
+	};
+
+	MMGActionSceneItemsAlignment(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x1281); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *trActionName() const override { return "Align"; };
+	static constexpr const char *trActionName() { return "Align"; };
 
 	const char *sourceSignalName() const override { return "item_transform"; };
 
@@ -311,11 +399,17 @@ class MMGActionSceneItemsScaleFilter : public MMGActionSceneItems {
 	Q_OBJECT
 
 public:
-	MMGActionSceneItemsScaleFilter(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGActionSceneItems::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGValue<obs_scale_type> scale_filter;
+	};
+
+	MMGActionSceneItemsScaleFilter(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x1282); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *trActionName() const override { return "ScaleFiltering"; };
+	static constexpr const char *trActionName() { return "ScaleFiltering"; };
 
 	const char *sourceSignalName() const override { return "item_transform"; };
 
@@ -343,11 +437,17 @@ class MMGActionSceneItemsBlendingMode : public MMGActionSceneItems {
 	Q_OBJECT
 
 public:
-	MMGActionSceneItemsBlendingMode(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGActionSceneItems::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGValue<obs_blending_type> blending_mode;
+	};
+
+	MMGActionSceneItemsBlendingMode(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x1283); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *trActionName() const override { return "BlendingMode"; };
+	static constexpr const char *trActionName() { return "BlendingMode"; };
 
 	const char *sourceSignalName() const override { return "item_transform"; };
 
@@ -375,11 +475,17 @@ class MMGActionSceneItemsBoundingBoxType : public MMGActionSceneItems {
 	Q_OBJECT
 
 public:
-	MMGActionSceneItemsBoundingBoxType(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGActionSceneItems::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGValue<obs_bounds_type> bounds_type;
+	};
+
+	MMGActionSceneItemsBoundingBoxType(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x12c1); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *trActionName() const override { return "BoundingBoxType"; };
+	static constexpr const char *trActionName() { return "BoundingBoxType"; };
 
 	const char *sourceSignalName() const override { return "item_transform"; };
 
@@ -407,11 +513,18 @@ class MMGActionSceneItemsBoundingBoxSize : public MMGActionSceneItems {
 	Q_OBJECT
 
 public:
-	MMGActionSceneItemsBoundingBoxSize(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGActionSceneItems::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGFloat bounds_x;
+		MMGFloat bounds_y;
+	};
+
+	MMGActionSceneItemsBoundingBoxSize(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x12c2); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *trActionName() const override { return "BoundingBoxSize"; };
+	static constexpr const char *trActionName() { return "BoundingBoxSize"; };
 
 	const char *sourceSignalName() const override { return "item_transform"; };
 
@@ -441,11 +554,17 @@ class MMGActionSceneItemsBoundingBoxAlignment : public MMGActionSceneItems {
 	Q_OBJECT
 
 public:
-	MMGActionSceneItemsBoundingBoxAlignment(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGActionSceneItems::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGValue<Alignment> alignment;
+	};
+
+	MMGActionSceneItemsBoundingBoxAlignment(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x12c3); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *trActionName() const override { return "BoundingBoxAlign"; };
+	static constexpr const char *trActionName() { return "BoundingBoxAlign"; };
 
 	const char *sourceSignalName() const override { return "item_transform"; };
 
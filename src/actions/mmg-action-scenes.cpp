@@ -17,6 +17,7 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 */
 
 #include "mmg-action-scenes.h"
+#include "../mmg-obs-catalog.h"
 
 namespace MMGActions {
 
@@ -39,7 +40,7 @@ const MMGParams<MMGString> &sceneParams(char type)
 	return scene_params;
 };
 
-const MMGStringTranslationMap enumerateScenes()
+static MMGStringTranslationMap buildScenes()
 {
 	MMGStringTranslationMap list;
 
@@ -53,6 +54,11 @@ const MMGStringTranslationMap enumerateScenes()
 	return list;
 }
 
+const MMGStringTranslationMap enumerateScenes()
+{
+	return MMGOBSCatalog::lookup(MMGOBSCatalog::SCENES, {}, buildScenes);
+}
+
 static bool enumerateThruSceneItems(obs_scene_t *, obs_sceneitem_t *item, void *param)
 {
 	auto _names = reinterpret_cast<MMGStringTranslationMap *>(param);
@@ -64,7 +70,7 @@ static bool enumerateThruSceneItems(obs_scene_t *, obs_sceneitem_t *item, void *
 	return true;
 }
 
-const MMGStringTranslationMap enumerateSceneItems(const MMGString &scene_uuid)
+static MMGStringTranslationMap buildSceneItems(const MMGString &scene_uuid)
 {
 	MMGStringTranslationMap names;
 
@@ -75,6 +81,12 @@ const MMGStringTranslationMap enumerateSceneItems(const MMGString &scene_uuid)
 	return names;
 }
 
+const MMGStringTranslationMap enumerateSceneItems(const MMGString &scene_uuid)
+{
+	return MMGOBSCatalog::lookup(MMGOBSCatalog::SCENE_ITEMS, scene_uuid.value(),
+				     [&]() { return buildSceneItems(scene_uuid); });
+}
+
 MMGString currentScene(bool preview)
 {
 	return MMGString(obs_source_get_uuid(OBSSourceAutoRelease(preview ? obs_frontend_get_current_preview_scene()
@@ -88,10 +100,17 @@ const MMGParams<bool> MMGActionScenesSwitch::preview_params {
 	.default_value = false,
 };
 
-MMGActionScenesSwitch::MMGActionScenesSwitch(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGAction(parent, json_obj),
+MMGActionScenesSwitch::Fields::Fields(const QJsonObject &json_obj)
+	: MMGAction::Fields(json_obj),
 	  use_preview(json_obj, "use_preview"),
 	  scene(json_obj, "scene")
+{
+}
+
+MMGActionScenesSwitch::MMGActionScenesSwitch(MMGActionManager *parent, Fields &&fields)
+	: MMGAction(parent, fields),
+	  use_preview(std::move(fields.use_preview)),
+	  scene(std::move(fields.scene))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -149,18 +168,16 @@ void MMGActionScenesSwitch::execute(const MMGMappingTest &test) const
 	blog(LOG_DEBUG, "Successfully executed.");
 }
 
-void MMGActionScenesSwitch::processEvent(obs_frontend_event event) const
+void MMGActionScenesSwitch::processEvent(const MMGSignal::MMGFrontendState &state) const
 {
-	if (event != OBS_FRONTEND_EVENT_SCENE_CHANGED) return;
-
 	EventFulfillment fulfiller(this);
-	fulfiller->addAcceptable(scene, currentScene(false));
+	fulfiller->addAcceptable(scene, state.scene());
 }
 // End MMGActionScenesSwitch
 
 // MMGActionScenesScreenshot
-MMGActionScenesScreenshot::MMGActionScenesScreenshot(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGAction(parent, json_obj)
+MMGActionScenesScreenshot::MMGActionScenesScreenshot(MMGActionManager *parent, Fields &&fields)
+	: MMGAction(parent, fields)
 {
 	blog(LOG_DEBUG, "Action created.");
 }
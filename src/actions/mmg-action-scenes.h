@@ -31,12 +31,19 @@ class MMGActionScenesSwitch : public MMGAction, public MMGSignal::MMGFrontendRec
 	Q_OBJECT
 
 public:
-	MMGActionScenesSwitch(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGAction::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGBoolean use_preview;
+		MMGStringID scene;
+	};
+
+	MMGActionScenesSwitch(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x1101); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *categoryName() const final override { return "Scenes"; };
-	const char *trActionName() const override { return "Switch"; };
+	static constexpr const char *categoryName() { return "Scenes"; };
+	static constexpr const char *trActionName() { return "Switch"; };
 
 	void initOldData(const QJsonObject &json_obj) override;
 	void json(QJsonObject &json_obj) const override;
@@ -47,7 +54,8 @@ public:
 private:
 	void execute(const MMGMappingTest &test) const override;
 	void connectSignal(bool connect) override { MMGSignal::connectMMGSignal(this, connect); };
-	void processEvent(obs_frontend_event event) const override;
+	QList<obs_frontend_event> frontendEvents() const override { return {OBS_FRONTEND_EVENT_SCENE_CHANGED}; };
+	void processEvent(const MMGSignal::MMGFrontendState &state) const override;
 
 private:
 	MMGBoolean use_preview;
@@ -61,20 +69,18 @@ class MMGActionScenesScreenshot : public MMGAction, public MMGSignal::MMGFronten
 	Q_OBJECT
 
 public:
-	MMGActionScenesScreenshot(MMGActionManager *parent, const QJsonObject &json_obj);
+	MMGActionScenesScreenshot(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x1111); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *categoryName() const final override { return "Scenes"; };
-	const char *trActionName() const override { return "Screenshot"; };
+	static constexpr const char *categoryName() { return "Scenes"; };
+	static constexpr const char *trActionName() { return "Screenshot"; };
 
 private:
 	void execute(const MMGMappingTest &test) const override;
 	void connectSignal(bool connect) override { MMGSignal::connectMMGSignal(this, connect); };
-	void processEvent(obs_frontend_event event) const override
-	{
-		if (event == OBS_FRONTEND_EVENT_SCREENSHOT_TAKEN) EventFulfillment fulfiller(this);
-	};
+	QList<obs_frontend_event> frontendEvents() const override { return {OBS_FRONTEND_EVENT_SCREENSHOT_TAKEN}; };
+	void processEvent(const MMGSignal::MMGFrontendState &) const override { EventFulfillment fulfiller(this); };
 };
 MMG_DECLARE_ACTION(MMGActionScenesScreenshot);
 
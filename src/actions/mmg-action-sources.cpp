@@ -17,6 +17,10 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 */
 
 #include "mmg-action-sources.h"
+#include "../mmg-obs-catalog.h"
+
+#include <algorithm>
+#include <cmath>
 
 namespace MMGActions {
 
@@ -28,7 +32,7 @@ static MMGParams<MMGString> source_params {
 	.placeholder = obstr("NoSources.Title"),
 };
 
-const MMGStringTranslationMap enumerateSources(uint64_t flags)
+static MMGStringTranslationMap buildSources(uint64_t flags)
 {
 	struct SourceEnumeration {
 		uint64_t source_flags;
@@ -53,6 +57,12 @@ const MMGStringTranslationMap enumerateSources(uint64_t flags)
 	return source_enum.source_names;
 }
 
+const MMGStringTranslationMap enumerateSources(uint64_t flags)
+{
+	return MMGOBSCatalog::lookup(MMGOBSCatalog::SOURCES, QByteArray::number(flags),
+				     [&]() { return buildSources(flags); });
+}
+
 const MMGStringTranslationMap enumerateAllSources()
 {
 	return enumerateSources(-1);
@@ -77,9 +87,15 @@ const MMGParams<MMGString> &sourceParams(uint64_t type)
 }
 
 // MMGActionSources
-MMGActionSources::MMGActionSources(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGAction(parent, json_obj),
+MMGActionSources::Fields::Fields(const QJsonObject &json_obj)
+	: MMGAction::Fields(json_obj),
 	  source(json_obj, "source")
+{
+}
+
+MMGActionSources::MMGActionSources(MMGActionManager *parent, Fields &&fields)
+	: MMGAction(parent, fields),
+	  source(std::move(fields.source))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -122,7 +138,7 @@ void MMGActionSources::onSourceChanged() const
 
 void MMGActionSources::execute(const MMGMappingTest &test) const
 {
-	OBSSourceAutoRelease obs_source = obs_get_source_by_uuid(MMGString(source));
+	OBSSourceAutoRelease obs_source = target.get(source);
 	ACTION_ASSERT(obs_source, "Source does not exist.");
 
 	execute(test, obs_source);
@@ -130,14 +146,70 @@ void MMGActionSources::execute(const MMGMappingTest &test) const
 
 void MMGActionSources::processEvent(const calldata_t *cd) const
 {
-	obs_source_t *signal_source = (obs_source_t *)(calldata_ptr(cd, "source"));
-	current_uuid = obs_source_get_uuid(signal_source);
-
 	EventFulfillment fulfiller(this);
 	processEvent(*fulfiller, cd);
 }
 // End MMGActionSources
 
+// Volume conversions run for every volume change in either direction, so they use tables instead of log10/pow.
+// Both split the value into a power of two, which is exact, and a remainder interpolated from a table, so
+// that any input resolution (7-bit, 14-bit or 32-bit values alike) is covered by the same two small tables.
+// Compared to 20 * log10(mul) and pow(10, db / 20), the error is below 1e-5 dB in either direction
+// (across the field's -100 dB to 0 dB, and beyond it until float precision itself is coarser than that)
+namespace MMGVolumeTables {
+
+static constexpr int table_size = 512;
+static constexpr double decibels_per_octave = 6.020599913279624; // 20 * log10(2)
+
+struct Tables {
+	Tables()
+	{
+		for (int i = 0; i <= table_size; ++i) {
+			log2_mantissa[i] = float(std::log2(0.5 + 0.5 * i / table_size));
+			exp2_fraction[i] = float(std::exp2(double(i) / table_size));
+		}
+	};
+
+	// log2(m) for m in [0.5, 1], and 2^f for f in [0, 1]
+	float log2_mantissa[table_size + 1];
+	float exp2_fraction[table_size + 1];
+};
+
+static const Tables &tables()
+{
+	static const Tables _tables;
+	return _tables;
+}
+
+static float interpolate(const float *table, float position)
+{
+	int index = std::min(int(position), table_size - 1);
+	float fraction = position - float(index);
+	return table[index] + (table[index + 1] - table[index]) * fraction;
+}
+
+static float toDecibels(float mul)
+{
+	if (!(mul > 0.0f) || !std::isfinite(mul)) return float(20.0 * std::log10(mul));
+
+	int exponent;
+	float mantissa = std::frexp(mul, &exponent);
+	float log2_mul = float(exponent) + interpolate(tables().log2_mantissa, (mantissa - 0.5f) * 2.0f * table_size);
+	return float(log2_mul * decibels_per_octave);
+}
+
+static float fromDecibels(float db)
+{
+	if (!std::isfinite(db)) return float(std::pow(10.0, db / 20.0));
+
+	double octaves = db / decibels_per_octave;
+	double whole = std::floor(octaves);
+	float fraction = interpolate(tables().exp2_fraction, float((octaves - whole) * table_size));
+	return std::ldexp(fraction, int(std::clamp(whole, -1000.0, 1000.0)));
+}
+
+} // namespace MMGVolumeTables
+
 // MMGActionSourcesAudioVolume
 MMGParams<MMGString> MMGActionSourcesAudioVolume::format_params {
 	.desc = mmgtr("Actions.Sources.Format"),
@@ -160,10 +232,19 @@ MMGParams<float> MMGActionSourcesAudioVolume::volume_params {
 	.incremental_bound = 50.0,
 };
 
-MMGActionSourcesAudioVolume::MMGActionSourcesAudioVolume(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGActionSources(parent, json_obj),
+MMGShadowValues<float> MMGActionSourcesAudioVolume::volume_shadows;
+
+MMGActionSourcesAudioVolume::Fields::Fields(const QJsonObject &json_obj)
+	: MMGActionSources::Fields(json_obj),
 	  format(json_obj, "format"),
 	  volume(json_obj, "volume")
+{
+}
+
+MMGActionSourcesAudioVolume::MMGActionSourcesAudioVolume(MMGActionManager *parent, Fields &&fields)
+	: MMGActionSources(parent, std::move(fields)),
+	  format(std::move(fields.format)),
+	  volume(std::move(fields.volume))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -224,12 +305,23 @@ void MMGActionSourcesAudioVolume::onFormatChanged() const
 	volume_params.incremental_bound = 50.0;
 }
 
+float MMGActionSourcesAudioVolume::convertIfToDecibels(float mul) const
+{
+	return format == "dB" ? MMGVolumeTables::toDecibels(mul) : mul * 100.0f;
+}
+
+float MMGActionSourcesAudioVolume::convertIfFromDecibels(float db) const
+{
+	return format == "dB" ? MMGVolumeTables::fromDecibels(db) : db / 100.0f;
+}
+
 void MMGActionSourcesAudioVolume::execute(const MMGMappingTest &test, obs_source_t *obs_source) const
 {
-	float current_volume = convertIfToDecibels(obs_source_get_volume(obs_source));
-	ACTION_ASSERT(test.applicable(volume, current_volume),
-		      "A volume could not be selected. Check the Volume field and try again.");
-	obs_source_set_volume(obs_source, convertIfFromDecibels(current_volume));
+	bool applied = volume_shadows.update(
+		obs_source, [&]() { return convertIfToDecibels(obs_source_get_volume(obs_source)); },
+		[&](float &current_volume) { return test.applicable(volume, current_volume); },
+		[&](float new_volume) { obs_source_set_volume(obs_source, convertIfFromDecibels(new_volume)); });
+	ACTION_ASSERT(applied, "A volume could not be selected. Check the Volume field and try again.");
 }
 
 void MMGActionSourcesAudioVolume::processEvent(MMGMappingTest &test, const calldata_t *cd) const
@@ -245,9 +337,15 @@ MMGParams<bool> MMGActionSourcesAudioMute::mute_params {
 	.default_value = true,
 };
 
-MMGActionSourcesAudioMute::MMGActionSourcesAudioMute(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGActionSources(parent, json_obj),
+MMGActionSourcesAudioMute::Fields::Fields(const QJsonObject &json_obj)
+	: MMGActionSources::Fields(json_obj),
 	  mute(json_obj, "muted")
+{
+}
+
+MMGActionSourcesAudioMute::MMGActionSourcesAudioMute(MMGActionManager *parent, Fields &&fields)
+	: MMGActionSources(parent, std::move(fields)),
+	  mute(std::move(fields.mute))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -316,9 +414,15 @@ MMGParams<int64_t> MMGActionSourcesAudioSyncOffset::offset_params {
 	.incremental_bound = 5000.0,
 };
 
-MMGActionSourcesAudioSyncOffset::MMGActionSourcesAudioSyncOffset(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGActionSources(parent, json_obj),
+MMGActionSourcesAudioSyncOffset::Fields::Fields(const QJsonObject &json_obj)
+	: MMGActionSources::Fields(json_obj),
 	  offset(json_obj, "offset")
+{
+}
+
+MMGActionSourcesAudioSyncOffset::MMGActionSourcesAudioSyncOffset(MMGActionManager *parent, Fields &&fields)
+	: MMGActionSources(parent, std::move(fields)),
+	  offset(std::move(fields.offset))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -390,9 +494,15 @@ MMGParams<obs_monitoring_type> MMGActionSourcesAudioMonitor::monitor_params {
 		},
 };
 
-MMGActionSourcesAudioMonitor::MMGActionSourcesAudioMonitor(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGActionSources(parent, json_obj),
+MMGActionSourcesAudioMonitor::Fields::Fields(const QJsonObject &json_obj)
+	: MMGActionSources::Fields(json_obj),
 	  monitor(json_obj, "monitor")
+{
+}
+
+MMGActionSourcesAudioMonitor::MMGActionSourcesAudioMonitor(MMGActionManager *parent, Fields &&fields)
+	: MMGActionSources(parent, std::move(fields)),
+	  monitor(std::move(fields.monitor))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -468,9 +578,15 @@ MMGParams<MMGActionSourcesMediaState::Actions> MMGActionSourcesMediaState::media
 		},
 };
 
-MMGActionSourcesMediaState::MMGActionSourcesMediaState(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGActionSources(parent, json_obj),
+MMGActionSourcesMediaState::Fields::Fields(const QJsonObject &json_obj)
+	: MMGActionSources::Fields(json_obj),
 	  media_state(json_obj, "media_state")
+{
+}
+
+MMGActionSourcesMediaState::MMGActionSourcesMediaState(MMGActionManager *parent, Fields &&fields)
+	: MMGActionSources(parent, std::move(fields)),
+	  media_state(std::move(fields.media_state))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -620,9 +736,17 @@ MMGParams<int64_t> MMGActionSourcesMediaTime::time_params {
 	.incremental_bound = 6000.0,
 };
 
-MMGActionSourcesMediaTime::MMGActionSourcesMediaTime(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGActionSources(parent, json_obj),
+MMGShadowValues<int64_t> MMGActionSourcesMediaTime::time_shadows;
+
+MMGActionSourcesMediaTime::Fields::Fields(const QJsonObject &json_obj)
+	: MMGActionSources::Fields(json_obj),
 	  time(json_obj, "time")
+{
+}
+
+MMGActionSourcesMediaTime::MMGActionSourcesMediaTime(MMGActionManager *parent, Fields &&fields)
+	: MMGActionSources(parent, std::move(fields)),
+	  time(std::move(fields.time))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -669,17 +793,25 @@ void MMGActionSourcesMediaTime::onSourceFixedChanged(const obs_source_t *obs_sou
 
 void MMGActionSourcesMediaTime::execute(const MMGMappingTest &test, obs_source_t *obs_source) const
 {
-	int64_t new_time = obs_source_media_get_time(obs_source) / 1000ll;
-	ACTION_ASSERT(test.applicable(time, new_time), "A media time could not be selected. Check the Time field and "
-						       "try again.");
-	obs_source_media_set_time(obs_source, new_time * 1000ll);
+	// Seeks are applied by the media itself, so OBS keeps reporting the old time for a while after each one
+	bool applied = time_shadows.update(
+		obs_source, [&]() { return obs_source_media_get_time(obs_source) / 1000ll; },
+		[&](int64_t &new_time) { return test.applicable(time, new_time); },
+		[&](int64_t new_time) { obs_source_media_set_time(obs_source, new_time * 1000ll); });
+	ACTION_ASSERT(applied, "A media time could not be selected. Check the Time field and try again.");
 }
 // End MMGActionSourcesMediaTime
 
 // MMGActionSourcesCustom
-MMGActionSourcesCustom::MMGActionSourcesCustom(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGActionSources(parent, json_obj),
-	  custom_data(new MMGOBSFields::MMGOBSObject(this, sourceId(), json_obj))
+MMGActionSourcesCustom::Fields::Fields(const QJsonObject &json_obj)
+	: MMGActionSources::Fields(json_obj),
+	  custom_json(json_obj)
+{
+}
+
+MMGActionSourcesCustom::MMGActionSourcesCustom(MMGActionManager *parent, Fields &&fields)
+	: MMGActionSources(parent, std::move(fields)),
+	  custom_data(new MMGOBSFields::MMGOBSObject(this, sourceId(), fields.custom_json))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -32,11 +32,16 @@ class MMGActionSources : public MMGAction, public MMGSignal::MMGSourceReceiver {
 	Q_OBJECT
 
 public:
-	MMGActionSources(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGAction::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGStringID source;
+	};
+
+	MMGActionSources(MMGActionManager *parent, Fields &&fields);
 	virtual ~MMGActionSources() = default;
 
-	virtual const char *categoryName() const final override { return "Sources"; };
-	virtual const char *trActionName() const override = 0;
+	static constexpr const char *categoryName() { return "Sources"; };
 
 	MMGString sourceId() const final override { return source; };
 	virtual const char *sourceSignalName() const override = 0;
@@ -62,18 +67,25 @@ protected:
 private:
 	MMGStringID source;
 
-	mutable const char *current_uuid;
+	mutable MMGActions::MMGSourceTarget target;
 };
 
 class MMGActionSourcesAudioVolume : public MMGActionSources {
 	Q_OBJECT
 
 public:
-	MMGActionSourcesAudioVolume(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGActionSources::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGStringID format;
+		MMGFloat volume;
+	};
+
+	MMGActionSourcesAudioVolume(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x1301); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *trActionName() const override { return "Volume"; };
+	static constexpr const char *trActionName() { return "Volume"; };
 
 	const char *sourceSignalName() const override { return "volume"; };
 	uint64_t sourceBounds() const override { return OBS_SOURCE_AUDIO; };
@@ -91,8 +103,8 @@ private:
 	void processEvent(MMGMappingTest &test, const calldata_t *cd) const override;
 
 private:
-	float convertIfToDecibels(float pct) const { return format == "dB" ? 20.0 * std::log10(pct) : pct * 100.0; };
-	float convertIfFromDecibels(float db) const { return format == "dB" ? std::pow(10, db / 20.0) : db / 100.0; };
+	float convertIfToDecibels(float mul) const;
+	float convertIfFromDecibels(float db) const;
 
 private:
 	MMGStringID format;
@@ -100,16 +112,23 @@ private:
 
 	static MMGParams<MMGString> format_params;
 	static MMGParams<float> volume_params;
+	static MMGShadowValues<float> volume_shadows;
 };
 MMG_DECLARE_ACTION(MMGActionSourcesAudioVolume);
 
 class MMGActionSourcesAudioMute : public MMGActionSources {
 public:
-	MMGActionSourcesAudioMute(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGActionSources::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGBoolean mute;
+	};
+
+	MMGActionSourcesAudioMute(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x1302); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *trActionName() const override { return "MuteStatus"; };
+	static constexpr const char *trActionName() { return "MuteStatus"; };
 
 	const char *sourceSignalName() const override { return "mute"; };
 	uint64_t sourceBounds() const override { return OBS_SOURCE_AUDIO; };
@@ -134,11 +153,17 @@ MMG_DECLARE_ACTION(MMGActionSourcesAudioMute);
 
 class MMGActionSourcesAudioSyncOffset : public MMGActionSources {
 public:
-	MMGActionSourcesAudioSyncOffset(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGActionSources::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGValue<int64_t> offset;
+	};
+
+	MMGActionSourcesAudioSyncOffset(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x1351); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *trActionName() const override { return "AudioOffset"; };
+	static constexpr const char *trActionName() { return "AudioOffset"; };
 
 	const char *sourceSignalName() const override { return "audio_sync"; };
 	uint64_t sourceBounds() const override { return OBS_SOURCE_AUDIO; };
@@ -169,11 +194,17 @@ MMG_DECLARE_ACTION(MMGActionSourcesAudioSyncOffset);
 
 class MMGActionSourcesAudioMonitor : public MMGActionSources {
 public:
-	MMGActionSourcesAudioMonitor(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGActionSources::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGValue<obs_monitoring_type> monitor;
+	};
+
+	MMGActionSourcesAudioMonitor(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x1352); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *trActionName() const override { return "AudioMonitor"; };
+	static constexpr const char *trActionName() { return "AudioMonitor"; };
 
 	const char *sourceSignalName() const override { return "audio_monitoring"; };
 	uint64_t sourceBounds() const override { return OBS_SOURCE_AUDIO; };
@@ -198,7 +229,13 @@ MMG_DECLARE_ACTION(MMGActionSourcesAudioMonitor);
 
 class MMGActionSourcesMediaState : public MMGActionSources {
 public:
-	MMGActionSourcesMediaState(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGActionSources::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGValue<Actions> media_state;
+	};
+
+	MMGActionSourcesMediaState(MMGActionManager *parent, Fields &&fields);
 
 	enum Actions {
 		PLAY,
@@ -211,7 +248,7 @@ public:
 
 	static constexpr Id actionId() { return Id(0x13a1); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *trActionName() const override { return "MediaState"; };
+	static constexpr const char *trActionName() { return "MediaState"; };
 
 	const char *sourceSignalName() const override;
 	uint64_t sourceBounds() const override { return OBS_SOURCE_CONTROLLABLE_MEDIA; };
@@ -236,11 +273,17 @@ MMG_DECLARE_ACTION(MMGActionSourcesMediaState);
 
 class MMGActionSourcesMediaTime : public MMGActionSources {
 public:
-	MMGActionSourcesMediaTime(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGActionSources::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGValue<int64_t> time;
+	};
+
+	MMGActionSourcesMediaTime(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x13a2); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *trActionName() const override { return "Input.MediaTime"; };
+	static constexpr const char *trActionName() { return "Input.MediaTime"; };
 
 	const char *sourceSignalName() const override { return "n/a"; };
 	uint64_t sourceBounds() const override { return OBS_SOURCE_CONTROLLABLE_MEDIA; };
@@ -260,16 +303,23 @@ private:
 	MMGValue<int64_t> time;
 
 	static MMGParams<int64_t> time_params;
+	static MMGShadowValues<int64_t> time_shadows;
 };
 MMG_DECLARE_ACTION(MMGActionSourcesMediaTime);
 
 class MMGActionSourcesCustom : public MMGActionSources {
 public:
-	MMGActionSourcesCustom(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGActionSources::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		QJsonObject custom_json;
+	};
+
+	MMGActionSourcesCustom(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x13ff); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *trActionName() const override { return "Custom"; };
+	static constexpr const char *trActionName() { return "Custom"; };
 
 	const char *sourceSignalName() const override { return "update"; };
 	uint64_t sourceBounds() const override { return -1; };
@@ -26,9 +26,15 @@ const MMGParams<bool> MMGActionStream::stream_params {
 	.default_value = true,
 };
 
-MMGActionStream::MMGActionStream(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGAction(parent, json_obj),
+MMGActionStream::Fields::Fields(const QJsonObject &json_obj)
+	: MMGAction::Fields(json_obj),
 	  stream_state(json_obj, "stream_state")
+{
+}
+
+MMGActionStream::MMGActionStream(MMGActionManager *parent, Fields &&fields)
+	: MMGAction(parent, fields),
+	  stream_state(std::move(fields.stream_state))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -77,10 +83,10 @@ void MMGActionStream::execute(const MMGMappingTest &test) const
 	blog(LOG_DEBUG, "Successfully executed.");
 }
 
-void MMGActionStream::processEvent(obs_frontend_event event) const
+void MMGActionStream::processEvent(const MMGSignal::MMGFrontendState &state) const
 {
 	EventFulfillment fulfiller(this);
-	fulfiller->addAcceptable(stream_state, event, OBS_FRONTEND_EVENT_STREAMING_STARTED,
+	fulfiller->addAcceptable(stream_state, state.event(), OBS_FRONTEND_EVENT_STREAMING_STARTED,
 				 OBS_FRONTEND_EVENT_STREAMING_STOPPED);
 }
 
@@ -34,9 +34,15 @@ const MMGParams<bool> MMGActionStudioModeRunState::studio_params {
 	.default_value = true,
 };
 
-MMGActionStudioModeRunState::MMGActionStudioModeRunState(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGAction(parent, json_obj),
+MMGActionStudioModeRunState::Fields::Fields(const QJsonObject &json_obj)
+	: MMGAction::Fields(json_obj),
 	  studio_state(json_obj, "studio_state")
+{
+}
+
+MMGActionStudioModeRunState::MMGActionStudioModeRunState(MMGActionManager *parent, Fields &&fields)
+	: MMGAction(parent, fields),
+	  studio_state(std::move(fields.studio_state))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -84,18 +90,24 @@ void MMGActionStudioModeRunState::execute(const MMGMappingTest &test) const
 	blog(LOG_DEBUG, "Successfully executed.");
 }
 
-void MMGActionStudioModeRunState::processEvent(obs_frontend_event event) const
+void MMGActionStudioModeRunState::processEvent(const MMGSignal::MMGFrontendState &state) const
 {
 	EventFulfillment fulfiller(this);
-	fulfiller->addAcceptable(studio_state, event, OBS_FRONTEND_EVENT_STUDIO_MODE_ENABLED,
+	fulfiller->addAcceptable(studio_state, state.event(), OBS_FRONTEND_EVENT_STUDIO_MODE_ENABLED,
 				 OBS_FRONTEND_EVENT_STUDIO_MODE_DISABLED);
 }
 // End MMGActionStudioModeRunState
 
 // MMGActionStudioModePreview
-MMGActionStudioModePreview::MMGActionStudioModePreview(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGAction(parent, json_obj),
+MMGActionStudioModePreview::Fields::Fields(const QJsonObject &json_obj)
+	: MMGAction::Fields(json_obj),
 	  scene(json_obj, "scene")
+{
+}
+
+MMGActionStudioModePreview::MMGActionStudioModePreview(MMGActionManager *parent, Fields &&fields)
+	: MMGAction(parent, fields),
+	  scene(std::move(fields.scene))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -141,12 +153,12 @@ void MMGActionStudioModePreview::execute(const MMGMappingTest &test) const
 	blog(LOG_DEBUG, "Successfully executed.");
 }
 
-void MMGActionStudioModePreview::processEvent(obs_frontend_event event) const
+void MMGActionStudioModePreview::processEvent(const MMGSignal::MMGFrontendState &state) const
 {
-	if (event != OBS_FRONTEND_EVENT_PREVIEW_SCENE_CHANGED || !obs_frontend_preview_program_mode_active()) return;
+	if (!state.studioMode()) return;
 
 	EventFulfillment fulfiller(this);
-	fulfiller->addAcceptable(scene, currentScene(true));
+	fulfiller->addAcceptable(scene, state.scene(true));
 }
 // End MMGActionStudioModePreview
 
@@ -25,12 +25,18 @@ class MMGActionStudioModeRunState : public MMGAction, public MMGSignal::MMGFront
 	Q_OBJECT
 
 public:
-	MMGActionStudioModeRunState(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGAction::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGBoolean studio_state;
+	};
+
+	MMGActionStudioModeRunState(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x1001); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *categoryName() const override { return "StudioMode"; };
-	const char *trActionName() const override { return "ChangeState"; };
+	static constexpr const char *categoryName() { return "StudioMode"; };
+	static constexpr const char *trActionName() { return "ChangeState"; };
 
 	void initOldData(const QJsonObject &json_obj) override;
 	void json(QJsonObject &json_obj) const override;
@@ -41,7 +47,11 @@ public:
 private:
 	void execute(const MMGMappingTest &test) const override;
 	void connectSignal(bool connect) override { MMGSignal::connectMMGSignal(this, connect); };
-	void processEvent(obs_frontend_event event) const override;
+	QList<obs_frontend_event> frontendEvents() const override
+	{
+		return {OBS_FRONTEND_EVENT_STUDIO_MODE_ENABLED, OBS_FRONTEND_EVENT_STUDIO_MODE_DISABLED};
+	};
+	void processEvent(const MMGSignal::MMGFrontendState &state) const override;
 
 private:
 	MMGBoolean studio_state;
@@ -54,12 +64,18 @@ class MMGActionStudioModePreview : public MMGAction, public MMGSignal::MMGFronte
 	Q_OBJECT
 
 public:
-	MMGActionStudioModePreview(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGAction::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGStringID scene;
+	};
+
+	MMGActionStudioModePreview(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x1002); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *categoryName() const override { return "StudioMode"; };
-	const char *trActionName() const override { return "PreviewChange"; };
+	static constexpr const char *categoryName() { return "StudioMode"; };
+	static constexpr const char *trActionName() { return "PreviewChange"; };
 
 	void initOldData(const QJsonObject &json_obj) override;
 	void json(QJsonObject &json_obj) const override;
@@ -70,7 +86,11 @@ public:
 private:
 	void execute(const MMGMappingTest &test) const override;
 	void connectSignal(bool connect) override { MMGSignal::connectMMGSignal(this, connect); };
-	void processEvent(obs_frontend_event event) const override;
+	QList<obs_frontend_event> frontendEvents() const override
+	{
+		return {OBS_FRONTEND_EVENT_PREVIEW_SCENE_CHANGED};
+	};
+	void processEvent(const MMGSignal::MMGFrontendState &state) const override;
 
 private:
 	MMGStringID scene;
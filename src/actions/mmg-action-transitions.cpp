@@ -78,10 +78,17 @@ MMGParams<int32_t> MMGActionTransitionsCurrent::duration_params {
 	.step = 5.0,
 };
 
-MMGActionTransitionsCurrent::MMGActionTransitionsCurrent(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGAction(parent, json_obj),
+MMGActionTransitionsCurrent::Fields::Fields(const QJsonObject &json_obj)
+	: MMGAction::Fields(json_obj),
 	  transition(json_obj, "transition"),
 	  duration(json_obj, "duration")
+{
+}
+
+MMGActionTransitionsCurrent::MMGActionTransitionsCurrent(MMGActionManager *parent, Fields &&fields)
+	: MMGAction(parent, fields),
+	  transition(std::move(fields.transition)),
+	  duration(std::move(fields.duration))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -155,19 +162,16 @@ void MMGActionTransitionsCurrent::execute(const MMGMappingTest &test) const
 	obs_frontend_set_current_transition(obs_transition);
 }
 
-void MMGActionTransitionsCurrent::processEvent(obs_frontend_event event) const
+void MMGActionTransitionsCurrent::processEvent(const MMGSignal::MMGFrontendState &state) const
 {
-	if (event == OBS_FRONTEND_EVENT_TRANSITION_CHANGED) {
-		EventFulfillment fulfiller(this);
+	EventFulfillment fulfiller(this);
+	if (state.event() == OBS_FRONTEND_EVENT_TRANSITION_CHANGED) {
 		fulfiller->addCondition(transition->state() != STATE_IGNORE);
-		fulfiller->addAcceptable(transition, currentTransition());
-		fulfiller->addAcceptable(duration, obs_frontend_get_transition_duration());
-	} else if (event == OBS_FRONTEND_EVENT_TRANSITION_DURATION_CHANGED) {
-		EventFulfillment fulfiller(this);
+	} else {
 		fulfiller->addCondition(duration->state() != STATE_IGNORE);
-		fulfiller->addAcceptable(transition, currentTransition());
-		fulfiller->addAcceptable(duration, obs_frontend_get_transition_duration());
 	}
+	fulfiller->addAcceptable(transition, state.transition());
+	fulfiller->addAcceptable(duration, state.transitionDuration());
 }
 // End MMGActionTransitionsCurrent
 
@@ -194,10 +198,17 @@ MMGParams<int32_t> MMGActionTransitionsTBar::held_duration_params {
 
 MMGActionTransitionsTBar::Timer MMGActionTransitionsTBar::tbar_timer;
 
-MMGActionTransitionsTBar::MMGActionTransitionsTBar(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGAction(parent, json_obj),
+MMGActionTransitionsTBar::Fields::Fields(const QJsonObject &json_obj)
+	: MMGAction::Fields(json_obj),
 	  tbar(json_obj, "tbar"),
 	  held_duration(json_obj, "held_duration")
+{
+}
+
+MMGActionTransitionsTBar::MMGActionTransitionsTBar(MMGActionManager *parent, Fields &&fields)
+	: MMGAction(parent, fields),
+	  tbar(std::move(fields.tbar)),
+	  held_duration(std::move(fields.held_duration))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -247,20 +258,25 @@ void MMGActionTransitionsTBar::execute(const MMGMappingTest &test) const
 	});
 }
 
-void MMGActionTransitionsTBar::processEvent(obs_frontend_event event) const
+void MMGActionTransitionsTBar::processEvent(const MMGSignal::MMGFrontendState &state) const
 {
-	if (event != OBS_FRONTEND_EVENT_TBAR_VALUE_CHANGED) return;
-
 	EventFulfillment fulfiller(this);
-	fulfiller->addAcceptable(tbar, obs_frontend_get_tbar_position());
+	fulfiller->addAcceptable(tbar, state.tbarPosition());
 }
 // End MMGActionTransitionsTBar
 
 // MMGActionTransitionsCustom
-MMGActionTransitionsCustom::MMGActionTransitionsCustom(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGAction(parent, json_obj),
+MMGActionTransitionsCustom::Fields::Fields(const QJsonObject &json_obj)
+	: MMGAction::Fields(json_obj),
 	  transition(json_obj, "transition"),
-	  custom_data(new MMGOBSFields::MMGOBSObject(this, sourceFromName(), json_obj))
+	  custom_json(json_obj)
+{
+}
+
+MMGActionTransitionsCustom::MMGActionTransitionsCustom(MMGActionManager *parent, Fields &&fields)
+	: MMGAction(parent, fields),
+	  transition(std::move(fields.transition)),
+	  custom_data(new MMGOBSFields::MMGOBSObject(this, sourceFromName(), fields.custom_json))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -32,12 +32,19 @@ class MMGActionTransitionsCurrent : public MMGAction, public MMGSignal::MMGFront
 	Q_OBJECT
 
 public:
-	MMGActionTransitionsCurrent(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGAction::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGStringID transition;
+		MMGInteger duration;
+	};
+
+	MMGActionTransitionsCurrent(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x1401); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *categoryName() const override { return "Transitions"; };
-	const char *trActionName() const override { return "CurrentChange"; };
+	static constexpr const char *categoryName() { return "Transitions"; };
+	static constexpr const char *trActionName() { return "CurrentChange"; };
 
 	void initOldData(const QJsonObject &json_obj) override;
 	void json(QJsonObject &json_obj) const override;
@@ -49,7 +56,11 @@ public:
 private:
 	void execute(const MMGMappingTest &test) const override;
 	void connectSignal(bool connect) override { MMGSignal::connectMMGSignal(this, connect); };
-	void processEvent(obs_frontend_event event) const override;
+	QList<obs_frontend_event> frontendEvents() const override
+	{
+		return {OBS_FRONTEND_EVENT_TRANSITION_CHANGED, OBS_FRONTEND_EVENT_TRANSITION_DURATION_CHANGED};
+	};
+	void processEvent(const MMGSignal::MMGFrontendState &state) const override;
 
 private:
 	MMGStringID transition;
@@ -63,12 +74,19 @@ class MMGActionTransitionsTBar : public MMGAction, public MMGSignal::MMGFrontend
 	Q_OBJECT
 
 public:
-	MMGActionTransitionsTBar(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGAction::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGInteger tbar;
+		MMGInteger held_duration;
+	};
+
+	MMGActionTransitionsTBar(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x1481); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *categoryName() const override { return "Transitions"; };
-	const char *trActionName() const override { return "TBarChange"; };
+	static constexpr const char *categoryName() { return "Transitions"; };
+	static constexpr const char *trActionName() { return "TBarChange"; };
 
 	void initOldData(const QJsonObject &json_obj) override;
 	void json(QJsonObject &json_obj) const override;
@@ -79,7 +97,8 @@ public:
 private:
 	void execute(const MMGMappingTest &test) const override;
 	void connectSignal(bool connect) override { MMGSignal::connectMMGSignal(this, connect); };
-	void processEvent(obs_frontend_event event) const override;
+	QList<obs_frontend_event> frontendEvents() const override { return {OBS_FRONTEND_EVENT_TBAR_VALUE_CHANGED}; };
+	void processEvent(const MMGSignal::MMGFrontendState &state) const override;
 
 private:
 	MMGInteger tbar;
@@ -108,12 +127,19 @@ class MMGActionTransitionsCustom : public MMGAction, public MMGSignal::MMGSource
 	Q_OBJECT
 
 public:
-	MMGActionTransitionsCustom(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGAction::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGStringID transition;
+		QJsonObject custom_json;
+	};
+
+	MMGActionTransitionsCustom(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x14ff); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *categoryName() const override { return "Transitions"; };
-	const char *trActionName() const override { return "Custom"; };
+	static constexpr const char *categoryName() { return "Transitions"; };
+	static constexpr const char *trActionName() { return "Custom"; };
 
 	MMGString sourceId() const final override { return sourceFromName(); };
 	const char *sourceSignalName() const final override { return "update"; };
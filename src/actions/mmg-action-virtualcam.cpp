@@ -26,9 +26,15 @@ const MMGParams<bool> MMGActionVirtualCam::vircam_params {
 	.default_value = true,
 };
 
-MMGActionVirtualCam::MMGActionVirtualCam(MMGActionManager *parent, const QJsonObject &json_obj)
-	: MMGAction(parent, json_obj),
+MMGActionVirtualCam::Fields::Fields(const QJsonObject &json_obj)
+	: MMGAction::Fields(json_obj),
 	  vircam_state(json_obj, "vircam_state")
+{
+}
+
+MMGActionVirtualCam::MMGActionVirtualCam(MMGActionManager *parent, Fields &&fields)
+	: MMGAction(parent, fields),
+	  vircam_state(std::move(fields.vircam_state))
 {
 	blog(LOG_DEBUG, "Action created.");
 }
@@ -76,10 +82,10 @@ void MMGActionVirtualCam::execute(const MMGMappingTest &test) const
 	blog(LOG_DEBUG, "Successfully executed.");
 }
 
-void MMGActionVirtualCam::processEvent(obs_frontend_event event) const
+void MMGActionVirtualCam::processEvent(const MMGSignal::MMGFrontendState &state) const
 {
 	EventFulfillment fulfiller(this);
-	fulfiller->addAcceptable(vircam_state, event, OBS_FRONTEND_EVENT_VIRTUALCAM_STARTED,
+	fulfiller->addAcceptable(vircam_state, state.event(), OBS_FRONTEND_EVENT_VIRTUALCAM_STARTED,
 				 OBS_FRONTEND_EVENT_VIRTUALCAM_STOPPED);
 }
 
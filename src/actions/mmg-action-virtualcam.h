@@ -25,12 +25,18 @@ class MMGActionVirtualCam : public MMGAction, public MMGSignal::MMGFrontendRecei
 	Q_OBJECT
 
 public:
-	MMGActionVirtualCam(MMGActionManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGAction::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGBoolean vircam_state;
+	};
+
+	MMGActionVirtualCam(MMGActionManager *parent, Fields &&fields);
 
 	static constexpr Id actionId() { return Id(0x0301); };
 	constexpr Id id() const final override { return actionId(); };
-	const char *categoryName() const final override { return "VirtualCamera"; };
-	const char *trActionName() const final override { return "ChangeState"; };
+	static constexpr const char *categoryName() { return "VirtualCamera"; };
+	static constexpr const char *trActionName() { return "ChangeState"; };
 
 	void initOldData(const QJsonObject &json_obj) override;
 	void json(QJsonObject &json_obj) const override;
@@ -41,7 +47,11 @@ public:
 private:
 	void execute(const MMGMappingTest &test) const override;
 	void connectSignal(bool connect) override { MMGSignal::connectMMGSignal(this, connect); };
-	void processEvent(obs_frontend_event event) const override;
+	QList<obs_frontend_event> frontendEvents() const override
+	{
+		return {OBS_FRONTEND_EVENT_VIRTUALCAM_STARTED, OBS_FRONTEND_EVENT_VIRTUALCAM_STOPPED};
+	};
+	void processEvent(const MMGSignal::MMGFrontendState &state) const override;
 
 private:
 	MMGBoolean vircam_state;
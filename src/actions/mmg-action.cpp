@@ -29,27 +29,38 @@ struct ActionTypeInfo {
 
 static QMap<Id, ActionTypeInfo> all_action_types;
 
-ConstructBase::ConstructBase(MMGAction *action)
+ConstructBase::ConstructBase(const Info &info)
 {
-	all_action_types.insert(action->id(), {action->categoryName(), action->trActionName(), this});
+	all_action_types.insert(info.id, {info.cat_name, info.action_name, this});
 };
 
+// Registration is over before any of these are asked for, so they are only built once
 const MMGTranslationMap<Id> availableActionCategories()
 {
-	MMGTranslationMap<Id> categories;
+	static const MMGTranslationMap<Id> categories = []() {
+		MMGTranslationMap<Id> categories;
 
-	for (auto [id, info] : all_action_types.asKeyValueRange()) {
-		Id category = Id(id & 0xff00);
-		if (categories.contains(category)) continue;
+		for (auto [id, info] : all_action_types.asKeyValueRange()) {
+			Id category = Id(id & 0xff00);
+			if (categories.contains(category)) continue;
 
-		categories.insert(category, mmgtr(MMGText::join("Actions.Titles", info.cat_name)));
-	}
+			categories.insert(category, mmgtr(MMGText::join("Actions.Titles", info.cat_name)));
+		}
+
+		return categories;
+	}();
 
 	return categories;
 };
 
 const MMGTranslationMap<Id> availableActions(Id category_id, DeviceType type)
 {
+	static QHash<uint32_t, MMGTranslationMap<Id>> cache;
+
+	uint32_t key = (uint32_t(type) << 16) | uint16_t(category_id);
+	auto cached = cache.constFind(key);
+	if (cached != cache.constEnd()) return *cached;
+
 	MMGTranslationMap<Id> actions;
 	std::string tr;
 
@@ -69,6 +80,7 @@ const MMGTranslationMap<Id> availableActions(Id category_id, DeviceType type)
 		actions.insert(id, mmgtr(tr.c_str()));
 	}
 
+	cache.insert(key, actions);
 	return actions;
 };
 
@@ -135,7 +147,7 @@ static void findOldActionId(QJsonObject &json_obj)
 	json_obj["id"] = id;
 }
 
-MMGAction *generateAction(MMGActionManager *parent, const QJsonObject &json_obj)
+Decoded decodeAction(const QJsonObject &json_obj)
 {
 	QJsonObject init_obj = json_obj;
 	bool old_json = config()->fileVersion() < MMGConfig::VERSION_3_1;
@@ -149,9 +161,34 @@ MMGAction *generateAction(MMGActionManager *parent, const QJsonObject &json_obj)
 		id = Id(0x0000);
 	}
 
+	Decoded decoded;
+	decoded.init = all_action_types.value(id).init;
+	decoded.fields = decoded.init->decode(init_obj);
+	if (old_json) decoded.old_json = init_obj;
+
+	return decoded;
+}
+
+MMGAction *generateAction(MMGActionManager *parent, Decoded &&decoded)
+{
+	MMGAction *new_action = (*decoded.init)(parent, std::move(*decoded.fields));
+	if (decoded.old_json) new_action->initOldData(*decoded.old_json);
+
+	return new_action;
+}
+
+MMGAction *generateAction(MMGActionManager *parent, const QJsonObject &json_obj)
+{
+	return generateAction(parent, decodeAction(json_obj));
+}
+
+MMGAction *cloneAction(MMGActionManager *parent, const MMGAction *source, Id id)
+{
+	if (!all_action_types.contains(id)) return nullptr;
+
 	auto init = all_action_types[id].init;
-	MMGAction *new_action = (*init)(parent, init_obj);
-	if (old_json) new_action->initOldData(init_obj);
+	MMGAction *new_action = (*init)(parent, std::move(*init->decode(QJsonObject())));
+	source->copy(new_action);
 
 	return new_action;
 }
@@ -161,24 +198,49 @@ bool changeAction(MMGActionManager *parent, MMGAction *&action, Id new_id)
 	if (!parent || !action) return false;
 	if (action->id() == new_id) return false;
 
-	QJsonObject json_obj;
-	action->json(json_obj);
-	MMGJson::setValue(json_obj, "id", new_id);
+	// Only the fields the two types have in common are carried over
+	MMGAction *new_action = cloneAction(parent, action, new_id);
+	if (!new_action) return false;
 
 	qsizetype index = parent->indexOf(action);
 	parent->remove(action);
-	action = parent->add(json_obj);
+	action = parent->add(new_action);
 	parent->move(parent->size() - 1, index);
 
 	return true;
 }
 
+// MMGSourceTarget
+OBSSourceAutoRelease MMGSourceTarget::get(const MMGString &target_uuid)
+{
+	std::scoped_lock lock(mutex);
+
+	if (!!weak_source && uuid == target_uuid) {
+		OBSSourceAutoRelease obs_source = obs_weak_source_get_source(weak_source);
+		if (!!obs_source && !obs_source_removed(obs_source)) return obs_source;
+	}
+
+	obs_weak_source_release(weak_source);
+
+	OBSSourceAutoRelease obs_source = obs_get_source_by_uuid(target_uuid);
+	weak_source = obs_source_get_weak_source(obs_source);
+	uuid = target_uuid;
+
+	return obs_source;
+}
+// End MMGSourceTarget
+
 } // namespace MMGActions
 
 // MMGAction
-MMGAction::MMGAction(MMGActionManager *parent, const QJsonObject &json_obj) : QObject(parent)
+MMGAction::Fields::Fields(const QJsonObject &json_obj)
+{
+	if (json_obj["name"].isString()) name = json_obj["name"].toString();
+}
+
+MMGAction::MMGAction(MMGActionManager *parent, const Fields &fields) : QObject(parent)
 {
-	setObjectName(json_obj["name"].toString(mmgtr("Actions.Untitled")));
+	setObjectName(fields.name.value_or(mmgtr("Actions.Untitled")));
 }
 
 DeviceType MMGAction::type() const
@@ -206,4 +268,9 @@ MMGAction *MMGAction::generate(MMGActionManager *parent, const QJsonObject &json
 {
 	return MMGActions::generateAction(parent, json_obj);
 }
+
+MMGAction *MMGAction::clone(MMGActionManager *parent, const MMGAction *source)
+{
+	return MMGActions::cloneAction(parent, source, source->id());
+}
 // End MMGAction
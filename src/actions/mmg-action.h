@@ -23,6 +23,9 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 #include "../mmg-params.h"
 #include "../mmg-signal.h"
 
+#include <mutex>
+#include <optional>
+
 class MMGAction;
 template <class T> class MMGManager;
 using MMGActionManager = MMGManager<MMGAction>;
@@ -42,12 +45,19 @@ protected:
 	using EventFulfillment = MMGMappingFulfillment<MMGAction>;
 
 public:
-	MMGAction(MMGActionManager *parent, const QJsonObject &json_obj);
+	// The values an action's JSON holds. Nothing here is a QObject or asks OBS for anything,
+	// so actions can be decoded from any thread
+	struct Fields {
+		Fields(const QJsonObject &json_obj);
+		virtual ~Fields() = default;
+
+		std::optional<QString> name;
+	};
+
+	MMGAction(MMGActionManager *parent, const Fields &fields);
 	virtual ~MMGAction() = default;
 
 	virtual constexpr MMGActions::Id id() const = 0;
-	virtual const char *categoryName() const = 0;
-	virtual const char *trActionName() const = 0;
 
 	virtual void initOldData(const QJsonObject &) {};
 
@@ -61,6 +71,7 @@ public:
 	virtual void connectSignal(bool connect) = 0;
 
 	static MMGAction *generate(MMGActionManager *parent, const QJsonObject &json_obj);
+	static MMGAction *clone(MMGActionManager *parent, const MMGAction *source);
 
 protected:
 	DeviceType type() const;
@@ -77,27 +88,59 @@ enum Id : uint16_t {};
 
 template <typename T>
 concept IsMMGAction =
-	std::derived_from<T, MMGAction> && std::constructible_from<T, MMGActionManager *, const QJsonObject &>;
+	std::derived_from<T, MMGAction> && std::derived_from<typename T::Fields, MMGAction::Fields> &&
+	std::constructible_from<T, MMGActionManager *, typename T::Fields &&> && requires {
+		{ T::actionId() } -> std::same_as<Id>;
+		{ T::categoryName() } -> std::same_as<const char *>;
+		{ T::trActionName() } -> std::same_as<const char *>;
+	};
+
+// Read from the type itself, so registering an action never constructs one
+struct Info {
+	Id id;
+	const char *cat_name;
+	const char *action_name;
+};
 
 struct ConstructBase {
-	ConstructBase(MMGAction *action);
+	ConstructBase(const Info &info);
 
-	virtual MMGAction *operator()(MMGActionManager *parent, const QJsonObject &json_obj) = 0;
+	virtual std::unique_ptr<MMGAction::Fields> decode(const QJsonObject &json_obj) = 0;
+	virtual MMGAction *operator()(MMGActionManager *parent, MMGAction::Fields &&fields) = 0;
 };
 
 template <typename T> requires IsMMGAction<T> struct Construct : public ConstructBase {
-	Construct() : ConstructBase(std::make_unique<T>(nullptr, QJsonObject()).get()) {};
+	static constexpr Info info {T::actionId(), T::categoryName(), T::trActionName()};
+
+	Construct() : ConstructBase(info) {};
+
+	std::unique_ptr<MMGAction::Fields> decode(const QJsonObject &json_obj) override
+	{
+		return std::make_unique<typename T::Fields>(json_obj);
+	};
 
-	MMGAction *operator()(MMGActionManager *parent, const QJsonObject &json_obj) override
+	MMGAction *operator()(MMGActionManager *parent, MMGAction::Fields &&fields) override
 	{
-		return new T(parent, json_obj);
+		return new T(parent, static_cast<typename T::Fields &&>(fields));
 	};
 };
 
+// An action decoded from its JSON, which is only generated once it is on its manager's thread
+struct Decoded {
+	ConstructBase *init = nullptr;
+	std::unique_ptr<MMGAction::Fields> fields;
+
+	// Only kept for configurations from before v3.1, whose data is converted once the action exists
+	std::optional<QJsonObject> old_json;
+};
+
 const MMGTranslationMap<Id> availableActionCategories();
 const MMGTranslationMap<Id> availableActions(Id category_id, DeviceType type);
 
+Decoded decodeAction(const QJsonObject &json_obj);
+MMGAction *generateAction(MMGActionManager *parent, Decoded &&decoded);
 MMGAction *generateAction(MMGActionManager *parent, const QJsonObject &json_obj);
+MMGAction *cloneAction(MMGActionManager *parent, const MMGAction *source, Id id);
 bool changeAction(MMGActionManager *parent, MMGAction *&action, Id new_id);
 
 template <typename T>
@@ -107,6 +150,70 @@ inline void createActionField(MMGWidgets::MMGActionDisplay *display, MMGValue<T>
 	MMGParameters::createField<T>((MMGWidgets::MMGValueManager *)(display), storage, params, cb);
 };
 
+// An action's target source, held weakly once found so that using it again skips the global source table.
+// Sources are found by UUID, so renaming one keeps it, and destroying one lets go of it
+class MMGSourceTarget {
+public:
+	MMGSourceTarget() = default;
+	MMGSourceTarget(const MMGSourceTarget &) = delete;
+	~MMGSourceTarget() { obs_weak_source_release(weak_source); };
+
+	OBSSourceAutoRelease get(const MMGString &target_uuid);
+
+private:
+	std::mutex mutex;
+	MMGString uuid;
+	obs_weak_source_t *weak_source = nullptr;
+};
+
+// The values last written to each source, so that relative changes (increments, toggles) build on each other
+// rather than on what OBS reports while earlier writes may still be on their way (e.g. media seeks).
+// A source's shadow is only trusted while OBS still reports what it did right after that write;
+// anything else means the source was changed elsewhere, and OBS is taken as it is.
+// Shadows are kept by UUID, and those of destroyed sources are dropped as more are added
+template <typename T> class MMGShadowValues {
+public:
+	MMGShadowValues() = default;
+	MMGShadowValues(const MMGShadowValues &) = delete;
+
+	template <typename Read, typename Modify, typename Write>
+	bool update(obs_source_t *target, Read read, Modify modify, Write write)
+	{
+		std::scoped_lock lock(mutex);
+
+		QString uuid = obs_source_get_uuid(target);
+		T value = read();
+		if (auto shadow = shadows.constFind(uuid); shadow != shadows.constEnd() && shadow->reported == value)
+			value = shadow->written;
+
+		if (!modify(value)) return false;
+		write(value);
+
+		if (!shadows.contains(uuid)) prune();
+		shadows.insert(uuid, {value, read(), {obs_source_get_weak_source(target), obs_weak_source_release}});
+		return true;
+	};
+
+private:
+	struct Shadow {
+		T written;
+		T reported;
+		std::shared_ptr<obs_weak_source_t> source;
+	};
+
+	void prune()
+	{
+		if (shadows.size() < prune_size) return;
+
+		shadows.removeIf([](const auto &it) { return obs_weak_source_expired(it.value().source.get()); });
+		prune_size = std::max<qsizetype>(16, shadows.size() * 2);
+	};
+
+	std::mutex mutex;
+	QHash<QString, Shadow> shadows;
+	qsizetype prune_size = 16;
+};
+
 #define MMG_DECLARE_ACTION(T) static Construct<T> _registration_##T {};
 
 #define ACTION_ASSERT(cond, str)                \
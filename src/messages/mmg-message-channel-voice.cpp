@@ -17,6 +17,8 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 */
 
 #include "mmg-message-channel-voice.h"
+#include "../mmg-midi-conditions.h"
+#include "../mmg-midi-pairing.h"
 
 namespace MMGMessages {
 
@@ -38,6 +40,31 @@ static constexpr void setMessageDataValue(MMGMessageData &message, uint32_t valu
 #define GROUP 4, 4
 #define CHANNEL 12, 4
 
+// Toggle values change whenever they are tested, so they cannot be compiled
+template <typename T> static bool compileBounds(const MMGValue<T> &value, int64_t offset, uint8_t &min, uint8_t &max)
+{
+	switch (value->state()) {
+		case STATE_FIXED:
+			min = max = uint8_t(value.template as<STATE_FIXED>()->value() - offset);
+			return true;
+
+		case STATE_RANGE: {
+			auto range = value.template as<STATE_RANGE>();
+			int64_t lower = std::min(range->min(), range->max()) - offset;
+			int64_t upper = std::max(range->min(), range->max()) - offset;
+			min = uint8_t(std::clamp<int64_t>(lower, 0x00, 0xff));
+			max = uint8_t(std::clamp<int64_t>(upper, 0x00, 0xff));
+			return true;
+		}
+
+		case STATE_TOGGLE:
+			return false;
+
+		default:
+			return true;
+	}
+}
+
 // MMGMessageChannelVoice
 static MMGParams<uint8_t> group_params {
 	.desc = mmgtr("Message.CV.Group"),
@@ -59,14 +86,21 @@ static MMGParams<uint8_t> channel_params {
 	.step = 1.0,
 };
 
-MMGMessageChannelVoice::MMGMessageChannelVoice(MMGMessageManager *parent, const QJsonObject &json_obj)
-	: MMGMessage(parent, json_obj),
+MMGMessageChannelVoice::Fields::Fields(const QJsonObject &json_obj)
+	: MMGMessage::Fields(json_obj),
 	  _group(json_obj, "group"),
 	  _channel(json_obj, "channel")
 {
 	if (_group->state() == STATE_FIXED && _group == uint8_t(0)) _group = 1;
 }
 
+MMGMessageChannelVoice::MMGMessageChannelVoice(MMGMessageManager *parent, Fields &&fields)
+	: MMGMessage(parent, fields),
+	  _group(std::move(fields._group)),
+	  _channel(std::move(fields._channel))
+{
+}
+
 void MMGMessageChannelVoice::initOldData(const QJsonObject &json_obj)
 {
 	// Old references don't know which field to use, so we assume the last field
@@ -103,6 +137,13 @@ void MMGMessageChannelVoice::createDisplay(MMGWidgets::MMGMessageDisplay *displa
 	MMGMessages::createMessageField(display, &_channel, &channel_params);
 }
 
+bool MMGMessageChannelVoice::compileConditions(MMGMIDIConditions::Row &row) const
+{
+	row.status = status();
+	if (usingMIDI2() && !compileBounds(_group, 1, row.group_min, row.group_max)) return false;
+	return compileBounds(_channel, 1, row.channel_min, row.channel_max);
+}
+
 void MMGMessageChannelVoice::processMessage(MMGMappingTest &test, const MMGMessageData &data) const
 {
 	test.addCondition(status() == data.status());
@@ -115,7 +156,7 @@ void MMGMessageChannelVoice::replaceString(QString &str) const
 	MMGMessage::replaceString(str);
 
 	str.replace("${group}", QString::number(_group));
-	str.replace("${status}", mmgtr(MMGText::join("Message.CV.Status", trMessageName())));
+	str.replace("${status}", mmgtr(MMGText::join("Message.CV.Status", MMGMessages::messageName(id()))));
 	str.replace("${channel}", QString::number(_channel));
 }
 
@@ -164,13 +205,20 @@ static MMGParams<uint16_t> velocity_params {
 	.upper_bound = 65535.0,
 };
 
-MMGMessageNote::MMGMessageNote(MMGMessageManager *parent, const QJsonObject &json_obj)
-	: MMGMessageChannelVoice(parent, json_obj),
+MMGMessageNote::Fields::Fields(const QJsonObject &json_obj)
+	: MMGMessageChannelVoice::Fields(json_obj),
 	  _note(json_obj, "note"),
 	  _velocity(json_obj, "velocity")
 {
 }
 
+MMGMessageNote::MMGMessageNote(MMGMessageManager *parent, Fields &&fields)
+	: MMGMessageChannelVoice(parent, std::move(fields)),
+	  _note(std::move(fields._note)),
+	  _velocity(std::move(fields._velocity))
+{
+}
+
 void MMGMessageNote::initOldData(const QJsonObject &json_obj)
 {
 	MMGMessageChannelVoice::initOldData(json_obj);
@@ -214,6 +262,11 @@ void MMGMessageNote::createDisplay(MMGWidgets::MMGMessageDisplay *display)
 	MMGMessages::createMessageField(display, &_velocity, &velocity_params);
 }
 
+bool MMGMessageNote::compileConditions(MMGMIDIConditions::Row &row) const
+{
+	return MMGMessageChannelVoice::compileConditions(row) && compileBounds(_note, 0, row.index_min, row.index_max);
+}
+
 void MMGMessageNote::processMessage(const MMGMessageData &data)
 {
 	MessageFulfillment fulfiller(this);
@@ -297,13 +350,27 @@ static MMGParams<uint32_t> value_params {
 	.upper_bound = 127.0,
 };
 
-MMGMessageControlChange::MMGMessageControlChange(MMGMessageManager *parent, const QJsonObject &json_obj)
-	: MMGMessageChannelVoice(parent, json_obj),
+MMGMessageControlChange::Fields::Fields(const QJsonObject &json_obj)
+	: MMGMessageChannelVoice::Fields(json_obj),
 	  _control(json_obj, "control"),
 	  _value(json_obj, "value")
 {
 }
 
+MMGMessageControlChange::MMGMessageControlChange(MMGMessageManager *parent, Fields &&fields)
+	: MMGMessageChannelVoice(parent, std::move(fields)),
+	  _control(std::move(fields._control)),
+	  _value(std::move(fields._value))
+{
+}
+
+uint32_t MMGMessageControlChange::getValue(const MMGMessageData &message)
+{
+	// Paired 14-bit controllers arrive as MIDI 2.0 packets in MIDI 1.0 as well
+	if (!usingMIDI2() && message.type() == MIDI2_CV) return message.get<VALUE>() >> 18;
+	return getMessageDataValue<VALUE, BYTE_3>(message);
+}
+
 void MMGMessageControlChange::initOldData(const QJsonObject &json_obj)
 {
 	MMGMessageChannelVoice::initOldData(json_obj);
@@ -342,20 +409,25 @@ void MMGMessageControlChange::createDisplay(MMGWidgets::MMGMessageDisplay *displ
 {
 	MMGMessageChannelVoice::createDisplay(display);
 
-	value_params.upper_bound = usingMIDI2() ? 4294967295.0 : 127.0;
+	value_params.upper_bound = usingMIDI2() ? 4294967295.0 : 16383.0;
 	MMGMessages::createMessageField(display, &_control, &control_params);
 	MMGMessages::createMessageField(display, &_value, &value_params);
 
 	if (usingMIDI2()) MMGParameters::createWarning((MMGWidgets::MMGValueManager *)(display), "Message.CV.Control");
 }
 
+bool MMGMessageControlChange::compileConditions(MMGMIDIConditions::Row &row) const
+{
+	return MMGMessageChannelVoice::compileConditions(row) && compileBounds(_control, 0, row.index_min, row.index_max);
+}
+
 void MMGMessageControlChange::processMessage(const MMGMessageData &data)
 {
 	MessageFulfillment fulfiller(this);
 	MMGMessageChannelVoice::processMessage(*fulfiller, data);
 
 	fulfiller->addAcceptable(_control, getMessageDataValue<CONTROL, BYTE_2>(data));
-	fulfiller->addAcceptable(_value, getMessageDataValue<VALUE, BYTE_3>(data));
+	fulfiller->addAcceptable(_value, getValue(data));
 }
 
 void MMGMessageControlChange::replaceString(QString &str) const
@@ -379,7 +451,7 @@ void MMGMessageControlChange::copyToMessageData(MMGMessageData &message, const M
 		blog(LOG_INFO, "A value could not be selected. Defaulted to a value of 0.");
 
 	setMessageDataValue<CONTROL, BYTE_2>(message, control);
-	setMessageDataValue<VALUE, BYTE_3>(message, value);
+	setMessageDataValue<VALUE, BYTE_3>(message, usingMIDI2() ? value : std::min(value, 127u));
 }
 
 void MMGMessageControlChange::copyFromMessageData(const MMGMessageData &data)
@@ -387,7 +459,7 @@ void MMGMessageControlChange::copyFromMessageData(const MMGMessageData &data)
 	MMGMessageChannelVoice::copyFromMessageData(data);
 
 	_control = getMessageDataValue<CONTROL, BYTE_2>(data);
-	_value = getMessageDataValue<VALUE, BYTE_3>(data);
+	_value = getValue(data);
 }
 // End MMGMessageControlChange
 
@@ -421,13 +493,20 @@ static MMGParams<uint16_t> bank_params {
 	.upper_bound = 16384.0,
 };
 
-MMGMessageProgramChange::MMGMessageProgramChange(MMGMessageManager *parent, const QJsonObject &json_obj)
-	: MMGMessageChannelVoice(parent, json_obj),
+MMGMessageProgramChange::Fields::Fields(const QJsonObject &json_obj)
+	: MMGMessageChannelVoice::Fields(json_obj),
 	  _program(json_obj, "program"),
 	  _bank(json_obj, "bank")
 {
 }
 
+MMGMessageProgramChange::MMGMessageProgramChange(MMGMessageManager *parent, Fields &&fields)
+	: MMGMessageChannelVoice(parent, std::move(fields)),
+	  _program(std::move(fields._program)),
+	  _bank(std::move(fields._bank))
+{
+}
+
 void MMGMessageProgramChange::initOldData(const QJsonObject &json_obj)
 {
 	MMGMessageChannelVoice::initOldData(json_obj);
@@ -525,12 +604,18 @@ static MMGParams<int32_t> pitch_params {
 	.upper_bound = +8191.0,
 };
 
-MMGMessagePitchBend::MMGMessagePitchBend(MMGMessageManager *parent, const QJsonObject &json_obj)
-	: MMGMessageChannelVoice(parent, json_obj),
+MMGMessagePitchBend::Fields::Fields(const QJsonObject &json_obj)
+	: MMGMessageChannelVoice::Fields(json_obj),
 	  _pitch(json_obj, "pitch")
 {
 }
 
+MMGMessagePitchBend::MMGMessagePitchBend(MMGMessageManager *parent, Fields &&fields)
+	: MMGMessageChannelVoice(parent, std::move(fields)),
+	  _pitch(std::move(fields._pitch))
+{
+}
+
 int32_t MMGMessagePitchBend::getPitch(const MMGMessageData &message)
 {
 	if (usingMIDI2()) {
@@ -628,4 +713,140 @@ void MMGMessagePitchBend::copyFromMessageData(const MMGMessageData &data)
 }
 // End MMGMessagePitchBend
 
+
+// MMGMessageParameter
+#define PARAM_BANK 16, 8
+#define PARAM_INDEX 24, 8
+#define PARAM_VALUE 32, 32
+
+static const MMGParams<uint8_t> param_bank_params {
+	.desc = mmgtr("Message.CV.ParameterBank"),
+	.options = OPTION_ALLOW_MIDI | OPTION_ALLOW_RANGE | OPTION_ALLOW_TOGGLE,
+	.default_value = 0,
+	.lower_bound = 0.0,
+	.upper_bound = 127.0,
+};
+
+static const MMGParams<uint8_t> param_index_params {
+	.desc = mmgtr("Message.CV.ParameterIndex"),
+	.options = OPTION_ALLOW_MIDI | OPTION_ALLOW_RANGE | OPTION_ALLOW_TOGGLE,
+	.default_value = 0,
+	.lower_bound = 0.0,
+	.upper_bound = 127.0,
+};
+
+static MMGParams<uint32_t> param_value_params {
+	.desc = mmgtr("Message.CV.Value"),
+	.options = OPTION_ALLOW_MIDI | OPTION_ALLOW_RANGE | OPTION_ALLOW_TOGGLE,
+	.default_value = 0,
+	.lower_bound = 0.0,
+	.upper_bound = 16383.0,
+};
+
+MMGMessageParameter::Fields::Fields(const QJsonObject &json_obj)
+	: MMGMessageChannelVoice::Fields(json_obj),
+	  _bank(json_obj, "bank"),
+	  _index(json_obj, "index"),
+	  _value(json_obj, "value")
+{
+}
+
+MMGMessageParameter::MMGMessageParameter(MMGMessageManager *parent, Fields &&fields)
+	: MMGMessageChannelVoice(parent, std::move(fields)),
+	  _bank(std::move(fields._bank)),
+	  _index(std::move(fields._index)),
+	  _value(std::move(fields._value))
+{
+}
+
+uint32_t MMGMessageParameter::getValue(const MMGMessageData &message)
+{
+	// 14-bit in MIDI 1.0, since these are always sent as Data Entry MSB / LSB pairs
+	return usingMIDI2() ? message.get<PARAM_VALUE>() : message.get<PARAM_VALUE>() >> 18;
+}
+
+void MMGMessageParameter::json(QJsonObject &message_obj) const
+{
+	MMGMessageChannelVoice::json(message_obj);
+
+	_bank->json(message_obj, "bank");
+	_index->json(message_obj, "index");
+	_value->json(message_obj, "value");
+}
+
+void MMGMessageParameter::copy(MMGMessage *dest) const
+{
+	MMGMessageChannelVoice::copy(dest);
+
+	auto *casted = qobject_cast<MMGMessageParameter *>(dest);
+	if (!casted) return;
+
+	_bank.copy(casted->_bank);
+	_index.copy(casted->_index);
+	_value.copy(casted->_value);
+}
+
+void MMGMessageParameter::createDisplay(MMGWidgets::MMGMessageDisplay *display)
+{
+	MMGMessageChannelVoice::createDisplay(display);
+
+	param_value_params.upper_bound = usingMIDI2() ? 4294967295.0 : 16383.0;
+	MMGMessages::createMessageField(display, &_bank, &param_bank_params);
+	MMGMessages::createMessageField(display, &_index, &param_index_params);
+	MMGMessages::createMessageField(display, &_value, &param_value_params);
+}
+
+bool MMGMessageParameter::compileConditions(MMGMIDIConditions::Row &row) const
+{
+	return MMGMessageChannelVoice::compileConditions(row) && compileBounds(_bank, 0, row.index_min, row.index_max);
+}
+
+void MMGMessageParameter::processMessage(const MMGMessageData &data)
+{
+	MessageFulfillment fulfiller(this);
+	MMGMessageChannelVoice::processMessage(*fulfiller, data);
+
+	fulfiller->addAcceptable(_bank, data.get<PARAM_BANK>());
+	fulfiller->addAcceptable(_index, data.get<PARAM_INDEX>());
+	fulfiller->addAcceptable(_value, getValue(data));
+}
+
+void MMGMessageParameter::replaceString(QString &str) const
+{
+	MMGMessageChannelVoice::replaceString(str);
+
+	str.replace("${bank}", QString::number(_bank));
+	str.replace("${index}", QString::number(_index));
+	str.replace("${value}", QString::number(_value));
+}
+
+void MMGMessageParameter::copyToMessageData(MMGMessageData &message, const MMGMappingTest &test) const
+{
+	// There is no MIDI 1.0 packet for these, so they are always built as MIDI 2.0
+	// and split into Control Changes by MIDI 1.0 ports
+	message.set<0, 4>(MIDI2_CV);
+	MMGMessageChannelVoice::copyToMessageData(message, test);
+
+	uint8_t bank = 0, index = 0;
+	uint32_t value = 0;
+	if (!test.applicable(_bank, bank)) blog(LOG_INFO, "A bank could not be selected. Defaulted to bank 0.");
+	if (!test.applicable(_index, index)) blog(LOG_INFO, "An index could not be selected. Defaulted to index 0.");
+	if (!test.applicable(_value, value))
+		blog(LOG_INFO, "A value could not be selected. Defaulted to a value of 0.");
+
+	message.set<PARAM_BANK>(bank & 0x7f);
+	message.set<PARAM_INDEX>(index & 0x7f);
+	message.set<PARAM_VALUE>(usingMIDI2() ? value : MMGMIDIPairing::scaleUp(std::min(value, 16383u), 14, 32));
+}
+
+void MMGMessageParameter::copyFromMessageData(const MMGMessageData &data)
+{
+	MMGMessageChannelVoice::copyFromMessageData(data);
+
+	_bank = data.get<PARAM_BANK>();
+	_index = data.get<PARAM_INDEX>();
+	_value = getValue(data);
+}
+// End MMGMessageParameter
+
 } // namespace MMGMessages
@@ -26,11 +26,20 @@ class MMGMessageChannelVoice : public MMGMessage {
 	Q_OBJECT
 
 public:
-	MMGMessageChannelVoice(MMGMessageManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGMessage::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMG8Bit _group;
+		MMG8Bit _channel;
+	};
+
+	MMGMessageChannelVoice(MMGMessageManager *parent, Fields &&fields);
 	virtual ~MMGMessageChannelVoice() = default;
 
-	const char *typeName() const final override { return "CV"; };
+	static constexpr const char *typeName() { return "CV"; };
 	virtual ChannelStatusCode status() const = 0;
+	uint16_t statusMask() const override { return 1 << (status() >> 4); };
+	bool compileConditions(MMGMIDIConditions::Row &row) const override;
 
 	void initOldData(const QJsonObject &json_obj) override;
 	void json(QJsonObject &message_obj) const override;
@@ -55,7 +64,16 @@ class MMGMessageNote : public MMGMessageChannelVoice {
 	Q_OBJECT
 
 public:
-	MMGMessageNote(MMGMessageManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGMessageChannelVoice::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMG8Bit _note;
+		MMG16Bit _velocity;
+	};
+
+	MMGMessageNote(MMGMessageManager *parent, Fields &&fields);
+
+	bool compileConditions(MMGMIDIConditions::Row &row) const override;
 
 	void initOldData(const QJsonObject &json_obj) override;
 	void json(QJsonObject &message_obj) const override;
@@ -78,10 +96,11 @@ class MMGMessageNoteOn : public MMGMessageNote {
 	Q_OBJECT
 
 public:
-	MMGMessageNoteOn(MMGMessageManager *parent, const QJsonObject &json_obj) : MMGMessageNote(parent, json_obj) {};
+	MMGMessageNoteOn(MMGMessageManager *parent, Fields &&fields) : MMGMessageNote(parent, std::move(fields)) {};
 
-	Id id() const final override { return Id(0x4090); };
-	const char *trMessageName() const final override { return "NoteOn"; };
+	static constexpr Id messageId() { return Id(0x4090); };
+	constexpr Id id() const final override { return messageId(); };
+	static constexpr const char *trMessageName() { return "NoteOn"; };
 	ChannelStatusCode status() const final override { return NOTE_ON; };
 };
 MMG_DECLARE_MESSAGE(MMGMessageNoteOn);
@@ -90,10 +109,11 @@ class MMGMessageNoteOff : public MMGMessageNote {
 	Q_OBJECT
 
 public:
-	MMGMessageNoteOff(MMGMessageManager *parent, const QJsonObject &json_obj) : MMGMessageNote(parent, json_obj) {};
+	MMGMessageNoteOff(MMGMessageManager *parent, Fields &&fields) : MMGMessageNote(parent, std::move(fields)) {};
 
-	Id id() const final override { return Id(0x4080); };
-	const char *trMessageName() const final override { return "NoteOff"; };
+	static constexpr Id messageId() { return Id(0x4080); };
+	constexpr Id id() const final override { return messageId(); };
+	static constexpr const char *trMessageName() { return "NoteOff"; };
 	ChannelStatusCode status() const final override { return NOTE_OFF; };
 };
 MMG_DECLARE_MESSAGE(MMGMessageNoteOff);
@@ -102,12 +122,15 @@ class MMGMessageNoteToggle : public MMGMessageNote {
 	Q_OBJECT
 
 public:
-	MMGMessageNoteToggle(MMGMessageManager *parent, const QJsonObject &json_obj)
-		: MMGMessageNote(parent, json_obj) {};
+	MMGMessageNoteToggle(MMGMessageManager *parent, Fields &&fields) : MMGMessageNote(parent, std::move(fields)) {};
 
-	Id id() const final override { return Id(0x409f); };
-	const char *trMessageName() const final override { return "ToggleNote"; };
+	static constexpr Id messageId() { return Id(0x409f); };
+	constexpr Id id() const final override { return messageId(); };
+	static constexpr const char *trMessageName() { return "ToggleNote"; };
 	ChannelStatusCode status() const final override { return note_type ? NOTE_ON : NOTE_OFF; };
+	uint16_t statusMask() const final override { return (1 << (NOTE_ON >> 4)) | (1 << (NOTE_OFF >> 4)); };
+	// The status alternates on every message, so every message is tested
+	bool compileConditions(MMGMIDIConditions::Row &) const final override { return false; };
 
 	void processMessage(const MMGMessageData &data) override;
 
@@ -123,12 +146,22 @@ class MMGMessageControlChange : public MMGMessageChannelVoice {
 	Q_OBJECT
 
 public:
-	MMGMessageControlChange(MMGMessageManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGMessageChannelVoice::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMG8Bit _control;
+		MMG32Bit _value;
+	};
 
-	Id id() const final override { return Id(0x40b0); };
-	const char *trMessageName() const final override { return "ControlChange"; };
+	MMGMessageControlChange(MMGMessageManager *parent, Fields &&fields);
+
+	static constexpr Id messageId() { return Id(0x40b0); };
+	constexpr Id id() const final override { return messageId(); };
+	static constexpr const char *trMessageName() { return "ControlChange"; };
 	ChannelStatusCode status() const final override { return CONTROL_CHANGE; };
 
+	bool compileConditions(MMGMIDIConditions::Row &row) const override;
+
 	void initOldData(const QJsonObject &json_obj) override;
 	void json(QJsonObject &message_obj) const override;
 	void copy(MMGMessage *dest) const override;
@@ -144,6 +177,8 @@ public:
 private:
 	MMG8Bit _control;
 	MMG32Bit _value;
+
+	static uint32_t getValue(const MMGMessageData &message);
 };
 MMG_DECLARE_MESSAGE(MMGMessageControlChange);
 
@@ -151,10 +186,18 @@ class MMGMessageProgramChange : public MMGMessageChannelVoice {
 	Q_OBJECT
 
 public:
-	MMGMessageProgramChange(MMGMessageManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGMessageChannelVoice::Fields {
+		Fields(const QJsonObject &json_obj);
 
-	Id id() const final override { return Id(0x40c0); };
-	const char *trMessageName() const final override { return "ProgramChange"; };
+		MMG8Bit _program;
+		MMG16Bit _bank;
+	};
+
+	MMGMessageProgramChange(MMGMessageManager *parent, Fields &&fields);
+
+	static constexpr Id messageId() { return Id(0x40c0); };
+	constexpr Id id() const final override { return messageId(); };
+	static constexpr const char *trMessageName() { return "ProgramChange"; };
 	ChannelStatusCode status() const final override { return PROGRAM_CHANGE; };
 
 	void initOldData(const QJsonObject &json_obj) override;
@@ -179,10 +222,17 @@ class MMGMessagePitchBend : public MMGMessageChannelVoice {
 	Q_OBJECT
 
 public:
-	MMGMessagePitchBend(MMGMessageManager *parent, const QJsonObject &json_obj);
+	struct Fields : MMGMessageChannelVoice::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMGInteger _pitch;
+	};
 
-	Id id() const final override { return Id(0x40e0); };
-	const char *trMessageName() const final override { return "PitchBend"; };
+	MMGMessagePitchBend(MMGMessageManager *parent, Fields &&fields);
+
+	static constexpr Id messageId() { return Id(0x40e0); };
+	constexpr Id id() const final override { return messageId(); };
+	static constexpr const char *trMessageName() { return "PitchBend"; };
 	ChannelStatusCode status() const final override { return PITCH_BEND; };
 
 	void initOldData(const QJsonObject &json_obj) override;
@@ -205,4 +255,69 @@ private:
 };
 MMG_DECLARE_MESSAGE(MMGMessagePitchBend);
 
+class MMGMessageParameter : public MMGMessageChannelVoice {
+	Q_OBJECT
+
+public:
+	struct Fields : MMGMessageChannelVoice::Fields {
+		Fields(const QJsonObject &json_obj);
+
+		MMG8Bit _bank;
+		MMG8Bit _index;
+		MMG32Bit _value;
+	};
+
+	MMGMessageParameter(MMGMessageManager *parent, Fields &&fields);
+
+	// Assembled from Control Changes when received from MIDI 1.0 devices
+	uint16_t statusMask() const final override { return (1 << (status() >> 4)) | (1 << (CONTROL_CHANGE >> 4)); };
+	bool compileConditions(MMGMIDIConditions::Row &row) const override;
+
+	void json(QJsonObject &message_obj) const override;
+	void copy(MMGMessage *dest) const override;
+
+	void createDisplay(MMGWidgets::MMGMessageDisplay *display) override;
+
+	void processMessage(const MMGMessageData &data) override;
+	void replaceString(QString &str) const override;
+
+	void copyFromMessageData(const MMGMessageData &data) override;
+	void copyToMessageData(MMGMessageData &message, const MMGMappingTest &test) const override;
+
+private:
+	MMG8Bit _bank;
+	MMG8Bit _index;
+	MMG32Bit _value;
+
+	static uint32_t getValue(const MMGMessageData &message);
+};
+
+class MMGMessageRegisteredParameter : public MMGMessageParameter {
+	Q_OBJECT
+
+public:
+	MMGMessageRegisteredParameter(MMGMessageManager *parent, Fields &&fields)
+		: MMGMessageParameter(parent, std::move(fields)) {};
+
+	static constexpr Id messageId() { return Id(0x4020); };
+	constexpr Id id() const final override { return messageId(); };
+	static constexpr const char *trMessageName() { return "RegisteredParameter"; };
+	ChannelStatusCode status() const final override { return RPN; };
+};
+MMG_DECLARE_MESSAGE(MMGMessageRegisteredParameter);
+
+class MMGMessageAssignableParameter : public MMGMessageParameter {
+	Q_OBJECT
+
+public:
+	MMGMessageAssignableParameter(MMGMessageManager *parent, Fields &&fields)
+		: MMGMessageParameter(parent, std::move(fields)) {};
+
+	static constexpr Id messageId() { return Id(0x4030); };
+	constexpr Id id() const final override { return messageId(); };
+	static constexpr const char *trMessageName() { return "AssignableParameter"; };
+	ChannelStatusCode status() const final override { return NRPN; };
+};
+MMG_DECLARE_MESSAGE(MMGMessageAssignableParameter);
+
 } // namespace MMGMessages
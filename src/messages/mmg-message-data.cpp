@@ -26,7 +26,7 @@ MMGMessageData::MMGMessageData() noexcept : msg(0) {}
 
 MMGMessageData::MMGMessageData(uint64_t message) noexcept : msg(message) {}
 
-MMGMessageData::MMGMessageData(const libremidi::message &midi) noexcept
+MMGMessageData::MMGMessageData(const libremidi::message &midi) noexcept : msg(0)
 {
 	set<0, 4>(MMGMessages::MIDI1_CV);
 	set<4, 4>(0);
@@ -41,6 +41,16 @@ MMGMessageData::MMGMessageData(const libremidi::ump &midi) noexcept
 	set<32, 32>(midi[1]);
 }
 
+MMGMessageData MMGMessageData::toProtocol(MMGMessages::Type protocol) const noexcept
+{
+	if (type() == protocol || !isCV()) return *this;
+	if (protocol == MMGMessages::MIDI2_CV) return MMGMessageData(libremidi::ump(*this));
+
+	// (N)RPN packets have no single MIDI 1.0 equivalent, and are understood as-is
+	if (status() == MMGMessages::RPN || status() == MMGMessages::NRPN) return *this;
+	return MMGMessageData(libremidi::midi1_from_ump(*this));
+}
+
 MMGMessages::ChannelStatusCode MMGMessageData::status() const noexcept
 {
 	if (!isCV()) return MMGMessages::RESERVED;
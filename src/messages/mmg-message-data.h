@@ -26,6 +26,10 @@ struct message;
 struct ump;
 } // namespace libremidi
 
+namespace MMGMIDIConditions {
+struct Row;
+} // namespace MMGMIDIConditions
+
 namespace MMGMessages {
 
 // MIDI 2.0 Specification section 2.1.4
@@ -79,6 +83,9 @@ public:
 	MMGMessageData(const libremidi::ump &midi) noexcept;
 	~MMGMessageData() = default;
 
+	uint64_t raw() const noexcept { return msg; };
+	MMGMessageData toProtocol(MMGMessages::Type protocol) const noexcept;
+
 	MMGMessages::Type type() const noexcept { return MMGMessages::Type(get<0, 4>()); };
 	bool isCV() const noexcept { return type() == MMGMessages::MIDI1_CV || type() == MMGMessages::MIDI2_CV; };
 
@@ -108,6 +115,11 @@ public:
 	virtual ~MMGMessageReceiver() = default;
 
 	virtual void processMessage(const MMGMessageData &data) = 0;
+
+	// One bit per status nibble that this receiver can handle
+	virtual uint16_t statusMask() const { return 0xffff; };
+	// Fills in the fields that a message must match; returns false if every message must be tested
+	virtual bool compileConditions(MMGMIDIConditions::Row &) const { return false; };
 };
 
 #endif // MMG_MESSAGE_DATA_H
@@ -30,9 +30,9 @@ struct MessageTypeInfo {
 
 static QMap<Id, MessageTypeInfo> all_message_types;
 
-ConstructBase::ConstructBase(MMGMessage *message)
+ConstructBase::ConstructBase(const Info &info)
 {
-	all_message_types.insert(message->id(), {message->typeName(), message->trMessageName(), this});
+	all_message_types.insert(info.id, {info.type_name, info.message_name, this});
 };
 
 bool usingMIDI2()
@@ -41,22 +41,32 @@ bool usingMIDI2()
 	       MMGPreferences::MMGPreferenceMIDI::MIDI_ALWAYS_2;
 }
 
+// Registration is over before any of these are asked for, so they are only built once
 const MMGTranslationMap<Id> availableMessageTypes()
 {
-	MMGTranslationMap<Id> types;
+	static const MMGTranslationMap<Id> types = []() {
+		MMGTranslationMap<Id> types;
 
-	for (auto [id, info] : all_message_types.asKeyValueRange()) {
-		Id type = Id(id & 0xff00);
-		if (types.contains(type)) continue;
+		for (auto [id, info] : all_message_types.asKeyValueRange()) {
+			Id type = Id(id & 0xff00);
+			if (types.contains(type)) continue;
 
-		types.insert(type, mmgtr(MMGText::join("Message.Titles", info.type_name)));
-	}
+			types.insert(type, mmgtr(MMGText::join("Message.Titles", info.type_name)));
+		}
+
+		return types;
+	}();
 
 	return types;
 };
 
 const MMGTranslationMap<Id> availableMessages(Id message_type)
 {
+	static QHash<uint16_t, MMGTranslationMap<Id>> cache;
+
+	auto cached = cache.constFind(message_type);
+	if (cached != cache.constEnd()) return *cached;
+
 	MMGTranslationMap<Id> messages;
 	std::string tr;
 
@@ -69,19 +79,27 @@ const MMGTranslationMap<Id> availableMessages(Id message_type)
 		messages.insert(id, mmgtr(tr.c_str()));
 	}
 
+	cache.insert(message_type, messages);
 	return messages;
 };
 
+const char *messageName(Id id)
+{
+	auto found = all_message_types.constFind(id);
+	return found != all_message_types.constEnd() ? found->message_name : "";
+}
+
 static MMGTranslationMap<uint16_t> old_ids {
 	{0x4090, nontr("Note On")},        {0x4080, nontr("Note Off")},   {0x40b0, nontr("Control Change")},
 	{0x40c0, nontr("Program Change")}, {0x40e0, nontr("Pitch Bend")},
 };
 
-MMGMessage *generateMessage(MMGMessageManager *parent, const QJsonObject &json_obj)
+Decoded decodeMessage(const QJsonObject &json_obj)
 {
 	QJsonObject init_obj = json_obj;
+	bool old_json = config()->fileVersion() < MMGConfig::VERSION_3_1;
 
-	if (config()->fileVersion() < MMGConfig::VERSION_3_1) {
+	if (old_json) {
 		MMG16Bit _type(init_obj, "type");
 		MMGCompatibility::initOldStringData(_type, init_obj, "type", 0, old_ids);
 
@@ -104,9 +122,34 @@ MMGMessage *generateMessage(MMGMessageManager *parent, const QJsonObject &json_o
 		id = Id(0x4080);
 	}
 
+	Decoded decoded;
+	decoded.init = all_message_types.value(id).init;
+	decoded.fields = decoded.init->decode(init_obj);
+	if (old_json) decoded.old_json = init_obj;
+
+	return decoded;
+}
+
+MMGMessage *generateMessage(MMGMessageManager *parent, Decoded &&decoded)
+{
+	MMGMessage *new_message = (*decoded.init)(parent, std::move(*decoded.fields));
+	if (decoded.old_json) new_message->initOldData(*decoded.old_json);
+
+	return new_message;
+}
+
+MMGMessage *generateMessage(MMGMessageManager *parent, const QJsonObject &json_obj)
+{
+	return generateMessage(parent, decodeMessage(json_obj));
+}
+
+MMGMessage *cloneMessage(MMGMessageManager *parent, const MMGMessage *source, Id id)
+{
+	if (!all_message_types.contains(id)) return nullptr;
+
 	auto init = all_message_types[id].init;
-	MMGMessage *new_message = (*init)(parent, init_obj);
-	if (config()->fileVersion() < MMGConfig::VERSION_3_1) new_message->initOldData(init_obj);
+	MMGMessage *new_message = (*init)(parent, std::move(*init->decode(QJsonObject())));
+	source->copy(new_message);
 
 	return new_message;
 }
@@ -116,13 +159,13 @@ bool changeMessage(MMGMessageManager *parent, MMGMessage *&message, Id new_id)
 	if (!parent || !message) return false;
 	if (message->id() == new_id) return false;
 
-	QJsonObject json_obj;
-	message->json(json_obj);
-	MMGJson::setValue(json_obj, "id", new_id);
+	// Only the fields the two types have in common are carried over
+	MMGMessage *new_message = cloneMessage(parent, message, new_id);
+	if (!new_message) return false;
 
 	qsizetype index = parent->indexOf(message);
 	parent->remove(message);
-	message = parent->add(json_obj);
+	message = parent->add(new_message);
 	parent->move(parent->size() - 1, index);
 
 	return true;
@@ -146,11 +189,17 @@ bool changeMessage(MMGMessageManager *parent, MMGMessage *&message, Id new_id)
 
 } // namespace MMGMessages
 
-MMGMessage::MMGMessage(MMGMessageManager *parent, const QJsonObject &json_obj) : QObject(parent)
+MMGMessage::Fields::Fields(const QJsonObject &json_obj)
+{
+	if (json_obj["name"].isString()) name = json_obj["name"].toString();
+	if (!json_obj.isEmpty()) device = json_obj["device"].toString();
+}
+
+MMGMessage::MMGMessage(MMGMessageManager *parent, const Fields &fields) : QObject(parent)
 {
-	setObjectName(json_obj["name"].toString(mmgtr("Message.Untitled")));
+	setObjectName(fields.name.value_or(mmgtr("Message.Untitled")));
 
-	if (!json_obj.isEmpty()) { setDevice(manager(device)->find(json_obj["device"].toString())); }
+	if (fields.device) setDevice(manager(device)->find(*fields.device));
 }
 
 void MMGMessage::setDevice(MMGMIDIPort *device)
@@ -212,4 +261,9 @@ MMGMessage *MMGMessage::generate(MMGMessageManager *parent, const QJsonObject &j
 {
 	return MMGMessages::generateMessage(parent, json_obj);
 }
+
+MMGMessage *MMGMessage::clone(MMGMessageManager *parent, const MMGMessage *source)
+{
+	return MMGMessages::cloneMessage(parent, source, source->id());
+}
 // End MMGMessage
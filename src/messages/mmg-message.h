@@ -23,6 +23,8 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 #include "../mmg-params.h"
 #include "mmg-message-data.h"
 
+#include <optional>
+
 class MMGMIDIPort;
 
 class MMGMessage;
@@ -44,15 +46,22 @@ protected:
 	using MessageFulfillment = MMGMappingFulfillment<MMGMessage>;
 
 public:
-	MMGMessage(MMGMessageManager *parent, const QJsonObject &json_obj);
+	// The values a message's JSON holds, with its device only named, so messages can be decoded from any thread
+	struct Fields {
+		Fields(const QJsonObject &json_obj);
+		virtual ~Fields() = default;
+
+		std::optional<QString> name;
+		std::optional<QString> device;
+	};
+
+	MMGMessage(MMGMessageManager *parent, const Fields &fields);
 	virtual ~MMGMessage() = default;
 
 	MMGMIDIPort *device() const { return _device; };
 	void setDevice(MMGMIDIPort *device);
 
 	virtual MMGMessages::Id id() const = 0;
-	virtual const char *typeName() const = 0;
-	virtual const char *trMessageName() const = 0;
 
 	void blog(int log_status, const QString &message) const;
 	virtual void initOldData(const QJsonObject &) {};
@@ -68,6 +77,7 @@ public:
 	virtual void copyFromMessageData(const MMGMessageData &data) = 0;
 
 	static MMGMessage *generate(MMGMessageManager *parent, const QJsonObject &json_obj);
+	static MMGMessage *clone(MMGMessageManager *parent, const MMGMessage *source);
 
 protected:
 	virtual void copyToMessageData(MMGMessageData &message, const MMGMappingTest &test) const = 0;
@@ -87,29 +97,62 @@ enum Id : uint16_t {};
 
 template <typename T>
 concept IsMMGMessage =
-	std::derived_from<T, MMGMessage> && std::constructible_from<T, MMGMessageManager *, const QJsonObject &>;
+	std::derived_from<T, MMGMessage> && std::derived_from<typename T::Fields, MMGMessage::Fields> &&
+	std::constructible_from<T, MMGMessageManager *, typename T::Fields &&> && requires {
+		{ T::messageId() } -> std::same_as<Id>;
+		{ T::typeName() } -> std::same_as<const char *>;
+		{ T::trMessageName() } -> std::same_as<const char *>;
+	};
+
+// Read from the type itself, so registering a message never constructs one
+struct Info {
+	Id id;
+	const char *type_name;
+	const char *message_name;
+};
 
 struct ConstructBase {
-	ConstructBase(MMGMessage *message);
+	ConstructBase(const Info &info);
 
-	virtual MMGMessage *operator()(MMGMessageManager *parent, const QJsonObject &json_obj) = 0;
+	virtual std::unique_ptr<MMGMessage::Fields> decode(const QJsonObject &json_obj) = 0;
+	virtual MMGMessage *operator()(MMGMessageManager *parent, MMGMessage::Fields &&fields) = 0;
 };
 
 template <typename T> requires IsMMGMessage<T> struct Construct : public ConstructBase {
-	Construct() : ConstructBase(std::make_unique<T>(nullptr, QJsonObject()).get()) {};
+	static constexpr Info info {T::messageId(), T::typeName(), T::trMessageName()};
 
-	MMGMessage *operator()(MMGMessageManager *parent, const QJsonObject &json_obj) override
+	Construct() : ConstructBase(info) {};
+
+	std::unique_ptr<MMGMessage::Fields> decode(const QJsonObject &json_obj) override
+	{
+		return std::make_unique<typename T::Fields>(json_obj);
+	};
+
+	MMGMessage *operator()(MMGMessageManager *parent, MMGMessage::Fields &&fields) override
 	{
-		return new T(parent, json_obj);
+		return new T(parent, static_cast<typename T::Fields &&>(fields));
 	};
 };
 
+// A message decoded from its JSON, which is only generated once it is on its manager's thread
+struct Decoded {
+	ConstructBase *init = nullptr;
+	std::unique_ptr<MMGMessage::Fields> fields;
+
+	// Only kept for configurations from before v3.1, whose data is converted once the message exists
+	std::optional<QJsonObject> old_json;
+};
+
 bool usingMIDI2();
 
 const MMGTranslationMap<Id> availableMessageTypes();
 const MMGTranslationMap<Id> availableMessages(Id message_type);
+const char *messageName(Id id);
 
+Decoded decodeMessage(const QJsonObject &json_obj);
+MMGMessage *generateMessage(MMGMessageManager *parent, Decoded &&decoded);
 MMGMessage *generateMessage(MMGMessageManager *parent, const QJsonObject &json_obj);
+MMGMessage *cloneMessage(MMGMessageManager *parent, const MMGMessage *source, Id id);
 bool changeMessage(MMGMessageManager *parent, MMGMessage *&message, Id new_id);
 
 template <typename T>
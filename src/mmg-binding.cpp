@@ -22,22 +22,47 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 #include <QThreadPool>
 
 // MMGBinding
-MMGBinding::MMGBinding(MMGBindingManager *parent, const QJsonObject &json_obj)
+MMGBinding::MMGBinding(MMGBindingManager *parent, const QJsonObject &json_obj) : MMGBinding(parent, decode(json_obj))
+{
+}
+
+MMGBinding::MMGBinding(MMGBindingManager *parent, Decoded &&decoded)
 	: QObject(parent),
-	  QRunnable(),
 	  _messages(new MMGMessageManager(this, "messages")),
 	  _actions(new MMGActionManager(this, "actions"))
 {
-	setObjectName(json_obj["name"].toString(mmgtr("Binding.Untitled")));
-	setAutoDelete(false);
+	setObjectName(decoded.name.value_or(mmgtr("Binding.Untitled")));
 
-	_enabled = json_obj["enabled"].toBool(true);
-	_type = (DeviceType)json_obj["type"].toInt();
-	reset_mode = json_obj["reset_mode"].toInt();
+	_enabled = decoded.enabled;
+	_type = decoded.type;
+	reset_mode = decoded.reset_mode;
 
+	// Only generating them is left, which creates their QObjects and finds their devices
 	MMGStates::MMGReferenceIndexHandler::setOldReferenceIndex(MMGStates::REFIDX_0);
-	_messages->load(json_obj);
-	_actions->load(json_obj);
+	for (MMGMessages::Decoded &message : decoded.messages)
+		_messages->add(MMGMessages::generateMessage(_messages, std::move(message)));
+	if (_messages->size() < 1) _messages->add();
+
+	for (MMGActions::Decoded &action : decoded.actions)
+		_actions->add(MMGActions::generateAction(_actions, std::move(action)));
+	if (_actions->size() < 1) _actions->add();
+}
+
+MMGBinding::Decoded MMGBinding::decode(const QJsonObject &json_obj)
+{
+	Decoded decoded;
+
+	if (json_obj["name"].isString()) decoded.name = json_obj["name"].toString();
+	decoded.enabled = json_obj["enabled"].toBool(true);
+	decoded.type = (DeviceType)json_obj["type"].toInt();
+	decoded.reset_mode = uint8_t(json_obj["reset_mode"].toInt());
+
+	for (const QJsonValue &message_val : json_obj["messages"].toArray())
+		decoded.messages.push_back(MMGMessages::decodeMessage(message_val.toObject()));
+	for (const QJsonValue &action_val : json_obj["actions"].toArray())
+		decoded.actions.push_back(MMGActions::decodeAction(action_val.toObject()));
+
+	return decoded;
 }
 
 void MMGBinding::setType(DeviceType type)
@@ -75,23 +100,25 @@ void MMGBinding::json(QJsonObject &binding_obj) const
 	_actions->json(binding_obj);
 }
 
-void MMGBinding::copy(MMGBinding *dest)
+void MMGBinding::copy(MMGBinding *dest) const
 {
 	dest->setObjectName(objectName());
 	dest->reset_mode = reset_mode;
 	dest->_type = _type;
 
-	QJsonObject json_obj;
-	dest->_messages->clear();
-	dest->_actions->clear();
-	_messages->json(json_obj);
-	_actions->json(json_obj);
-	dest->_messages->load(json_obj);
-	dest->_actions->load(json_obj);
+	_messages->copy(dest->_messages);
+	_actions->copy(dest->_actions);
 
 	dest->setEnabled(_enabled);
 }
 
+MMGBinding *MMGBinding::clone(MMGBindingManager *parent, const MMGBinding *source)
+{
+	auto *binding = new MMGBinding(parent);
+	source->copy(binding);
+	return binding;
+}
+
 void MMGBinding::setEnabled(bool val)
 {
 	_enabled = val;
@@ -134,6 +161,20 @@ void MMGBinding::setConnected(bool _connected)
 	}
 
 	connected = _connected;
+	connected ? publish() : snapshot.publish(new Snapshot {_type, resetMode()});
+}
+
+void MMGBinding::publish()
+{
+	// Disconnected bindings never execute, so they keep the empty snapshot from their disconnection
+	if (!connected) return;
+
+	snapshot.publish(new Snapshot {
+		_type,
+		resetMode(),
+		QList<MMGMessage *>(_messages->begin(), _messages->end()),
+		QList<MMGAction *>(_actions->begin(), _actions->end()),
+	});
 }
 
 void MMGBinding::refresh()
@@ -144,49 +185,90 @@ void MMGBinding::refresh()
 
 void MMGBinding::execute(const MMGMappingTest &test)
 {
-	if (_type == TYPE_OUTPUT) {
-		if (_messages->size() < 1) {
+	// Held until the run is done, so nothing in the snapshot can be reclaimed under it
+	MMGEpoch::ReadGuard guard;
+	const Snapshot *current = snapshot.load();
+	if (!current) return;
+
+	if (current->type == TYPE_OUTPUT) {
+		if (current->messages.size() < 1) {
 			blog(LOG_INFO, "EXECUTION FAILED: No messages to send!");
 			return;
 		}
 	} else {
-		if (_actions->size() < 1) {
+		if (current->actions.size() < 1) {
 			blog(LOG_INFO, "EXECUTION FAILED: No actions to execute!");
 			return;
 		}
 	}
 
-	_test = test;
-	stop_request = reset_mode != MMGBinding::BINDING_CONTINUOUS;
+	stop_request = current->reset_mode != MMGBinding::BINDING_CONTINUOUS;
 
-	QThreadPool::globalInstance()->start(this);
+	QThreadPool::globalInstance()->start([this, guard, current, test]() { run(current, test); });
 }
 
-void MMGBinding::run()
+void MMGBinding::run(const Snapshot *current, MMGMappingTest test)
 {
 	stop_request = false;
-	MMGMappingTest thread_test = _test;
 
-	if (_type == TYPE_OUTPUT) {
-		for (MMGMessage *message : *_messages) {
+	if (current->type == TYPE_OUTPUT) {
+		for (MMGMessage *message : current->messages) {
 			if (stop_request) break;
-			message->send(thread_test);
+			message->send(test);
 		}
 	} else {
-		for (MMGAction *action : *_actions) {
+		for (MMGAction *action : current->actions) {
 			if (stop_request) break;
-			action->execute(thread_test);
+			action->execute(test);
 		}
 	}
 
 	stop_request = false;
+	test.complete();
 }
 // End MMGBinding
 
+template <> void MMGBindingManager::load(const QJsonObject &json_obj)
+{
+	const QJsonArray json_arr = json_obj[key].toArray();
+	std::vector<MMGBinding::Decoded> decoded(json_arr.size());
+	MMGBinding::Decoded *decoded_data = decoded.data();
+
+	auto decodeRange = [&json_arr, decoded_data](qsizetype from, qsizetype to) {
+		for (qsizetype i = from; i < to; ++i)
+			decoded_data[i] = MMGBinding::decode(json_arr.at(i).toObject());
+	};
+
+	if (json_arr.size() < MMGBinding::parallel_decoding_minimum) {
+		decodeRange(0, json_arr.size());
+	} else {
+		QThreadPool pool;
+		qsizetype chunk = json_arr.size() / pool.maxThreadCount() + 1;
+		for (qsizetype from = 0; from < json_arr.size(); from += chunk)
+			pool.start([&decodeRange, &json_arr, from, chunk]() {
+				decodeRange(from, std::min(from + chunk, json_arr.size()));
+			});
+		pool.waitForDone();
+	}
+
+	// Devices, OBS and QObject parents are only ever touched from this manager's thread
+	for (MMGBinding::Decoded &binding : decoded)
+		add(new MMGBinding(this, std::move(binding)));
+	if (size() < 1) add();
+}
+
 template <> MMGBindingManager *MMGBindingManager::generate(MMGCollections *parent, const QJsonObject &json_obj)
 {
 	auto *manager = new MMGBindingManager(parent, "bindings");
 	manager->setObjectName(json_obj["name"].toString(mmgtr("Collection.Untitled")));
-	manager->load(json_obj);
+
+	// Collections without enabled bindings are not generated until they are used
+	bool deferrable = config()->fileVersion() == MMGConfig::currentFileVersion();
+	for (const QJsonValue &binding_val : json_obj["bindings"].toArray()) {
+		if (!deferrable) break;
+		deferrable = !binding_val["enabled"].toBool(true);
+	}
+
+	deferrable ? manager->defer(json_obj) : manager->load(json_obj);
 	return manager;
 }
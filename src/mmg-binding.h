@@ -21,20 +21,39 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 
 #include "actions/mmg-action.h"
 #include "messages/mmg-message.h"
+#include "mmg-epoch.h"
 #include "mmg-manager.h"
 
-#include <QRunnable>
+#include <optional>
+#include <vector>
 
 class MMGBinding;
 using MMGBindingManager = MMGManager<MMGBinding>;
 
-class MMGBinding : public QObject, QRunnable {
+class MMGBinding : public QObject {
 	Q_OBJECT
 
 public:
+	// What a binding's JSON decodes to, down to the values of each of its messages and actions,
+	// before anything touches devices, OBS or QObjects. Decoding only reads its JSON, so any thread can do it
+	struct Decoded {
+		std::optional<QString> name;
+		bool enabled = true;
+		DeviceType type = TYPE_INPUT;
+		uint8_t reset_mode = 0;
+		std::vector<MMGMessages::Decoded> messages;
+		std::vector<MMGActions::Decoded> actions;
+	};
+
 	MMGBinding(MMGBindingManager *parent, const QJsonObject &json_obj = QJsonObject());
+	MMGBinding(MMGBindingManager *parent, Decoded &&decoded);
 	virtual ~MMGBinding() = default;
 
+	static Decoded decode(const QJsonObject &json_obj);
+
+	// Collections with at least this many bindings are decoded across the thread pool
+	static inline qsizetype parallel_decoding_minimum = 64;
+
 	enum ResetMode : uint8_t { BINDING_TRIGGERED, BINDING_CONTINUOUS };
 
 	DeviceType type() const { return _type; };
@@ -47,11 +66,15 @@ public:
 	void refresh();
 
 	ResetMode resetMode() const { return (ResetMode)reset_mode; };
-	void setResetMode(short mode) { reset_mode = mode; }
+	void setResetMode(short mode)
+	{
+		reset_mode = mode;
+		publish();
+	};
 
 	void blog(int log_status, const QString &message) const;
 	void json(QJsonObject &binding_obj) const;
-	void copy(MMGBinding *dest);
+	void copy(MMGBinding *dest) const;
 
 	MMGMessageManager *messages() const { return _messages; };
 	MMGActionManager *actions() const { return _actions; };
@@ -59,16 +82,27 @@ public:
 	MMGMessage *messages(int index) const { return _messages->at(index); };
 	MMGAction *actions(int index) const { return _actions->at(index); };
 
+	void publish();
+
 	static MMGBinding *generate(MMGBindingManager *parent, const QJsonObject &json_obj)
 	{
 		return new MMGBinding(parent, json_obj);
 	};
+	static MMGBinding *clone(MMGBindingManager *parent, const MMGBinding *source);
 
 public slots:
 	void execute(const MMGMappingTest &test);
 
 private:
-	void run() override;
+	// What executions read, so that edits never change anything under a running binding
+	struct Snapshot {
+		DeviceType type;
+		ResetMode reset_mode;
+		QList<MMGMessage *> messages;
+		QList<MMGAction *> actions;
+	};
+
+	void run(const Snapshot *current, MMGMappingTest test);
 
 private:
 	DeviceType _type;
@@ -76,16 +110,18 @@ private:
 	bool connected = false;
 	uint8_t reset_mode = 0;
 
-	bool stop_request = false;
-	MMGMappingTest _test;
+	std::atomic_bool stop_request = false;
 
 	MMGMessageManager *_messages;
 	MMGActionManager *_actions;
+
+	MMGEpoch::Published<Snapshot> snapshot;
 };
 MMG_DECLARE_STREAM_OPERATORS(MMGBinding);
 
 using MMGCollections = MMGManager<MMGBindingManager>;
 MMG_DECLARE_STREAM_OPERATORS(MMGBindingManager);
+template <> void MMGBindingManager::load(const QJsonObject &json_obj);
 template <> MMGBindingManager *MMGBindingManager::generate(MMGCollections *parent, const QJsonObject &json_obj);
 
 #endif // MMG_BINDING_H
@@ -72,22 +72,30 @@ void MMGConfig::load(const QString &path_str)
 	blog(LOG_INFO, "Loading configuration...");
 
 	QFile file(filepath(path_str));
-	[[maybe_unused]] bool fileOpen = file.open(QFile::ReadOnly | QFile::Text);
+	bool binary = isBinaryPath(file.fileName());
+	[[maybe_unused]] bool fileOpen = file.open(binary ? QFile::ReadOnly : QFile::ReadOnly | QFile::Text);
 	QByteArray config_contents;
 	if (file.exists()) {
 		blog(LOG_INFO, QString("Loading configuration file data from %1...").arg(file.fileName()));
 		config_contents = file.readAll();
 	} else {
 		blog(LOG_INFO, "Configuration file not found. Loading new configuration data...");
+		binary = false;
 		config_contents = "{}";
 	}
 	file.close();
 
-	QJsonParseError parse_err;
-	doc = QJsonDocument::fromJson(config_contents, &parse_err).object();
-	if (parse_err.error != QJsonParseError::NoError) {
-		blog(LOG_INFO,
-		     "Configuration file data could not be loaded correctly. Reason: " + parse_err.errorString());
+	QString parse_err;
+	if (binary) {
+		doc = MMGJson::fromBinary(config_contents, &parse_err);
+	} else {
+		QJsonParseError json_err;
+		doc = QJsonDocument::fromJson(config_contents, &json_err).object();
+		if (json_err.error != QJsonParseError::NoError) parse_err = json_err.errorString();
+	}
+
+	if (!parse_err.isEmpty()) {
+		blog(LOG_INFO, "Configuration file data could not be loaded correctly. Reason: " + parse_err);
 	} else {
 		blog(LOG_INFO, "Configuration file data loaded. Extraction will begin when "
 			       "OBS has finished loading.");
@@ -117,9 +125,16 @@ void MMGConfig::finishLoad()
 	// that must occur after fully loading everything else
 	if (loading_file_version == VERSION_2_0) MMGCompatibility::oldConfigPostLoad();
 
-	for (MMGBindingManager *manager : *_collections)
+	for (MMGBindingManager *manager : *_collections) {
+		if (manager->deferred()) {
+			blog(LOG_DEBUG, QString("Collection <%1> has no enabled bindings and will be loaded when accessed.")
+						.arg(manager->objectName()));
+			continue;
+		}
+
 		for (MMGBinding *binding : *manager)
 			binding->refresh();
+	}
 
 	blog(LOG_INFO, "Configuration loading complete.");
 }
@@ -139,8 +154,13 @@ void MMGConfig::save(const QString &path_str) const
 	doc["file_version"] = currentFileVersion();
 
 	QFile file(filepath(path_str));
-	[[maybe_unused]] bool fileOpen = file.open(QFile::WriteOnly | QFile::Text | QFile::Truncate);
-	qlonglong result = file.write(MMGJson::toString(doc));
+	bool binary = isBinaryPath(file.fileName());
+	QByteArray config_contents = binary ? MMGJson::toBinary(doc) : MMGJson::toString(doc);
+
+	QFile::OpenMode mode = QFile::WriteOnly | QFile::Truncate;
+	if (!binary) mode |= QFile::Text;
+	[[maybe_unused]] bool fileOpen = file.open(mode);
+	qlonglong result = file.write(config_contents);
 	if (result < 0) {
 		blog(LOG_INFO, "Configuration unable to be saved. Reason: " + file.errorString());
 	} else {
@@ -156,8 +176,10 @@ void MMGConfig::clearAllData()
 
 QString MMGConfig::filepath(const QString &path_str)
 {
+	if (!path_str.isEmpty()) return path_str;
+
 	auto default_path = obs_module_config_path(filename());
-	QString full_path = !path_str.isEmpty() ? path_str : QString(default_path);
+	QString full_path = default_path;
 	bfree(default_path);
 	return full_path;
 }
@@ -54,6 +54,7 @@ public:
 
 	static const char *filename() { return "obs-midi-mg-config.json"; };
 	static QString filepath(const QString &path_str);
+	static bool isBinaryPath(const QString &path_str) { return path_str.endsWith(".cbor", Qt::CaseInsensitive); };
 	static FileVersion currentFileVersion() { return VERSION_3_1; };
 
 signals:
@@ -32,6 +32,14 @@ void MMGDevice::json(QJsonObject &device_obj) const
 	device_obj["name"] = objectName();
 	device_obj["active"] = (int)_active;
 	device_obj["thru"] = !!_thru ? _thru->objectName() : "";
+	device_obj["pair_controllers"] = pair_controllers;
+
+	if (loopback) {
+		QJsonObject generator_obj;
+		generator_settings.json(generator_obj);
+		device_obj["loopback"] = true;
+		device_obj["generator"] = generator_obj;
+	}
 }
 
 void MMGDevice::update(const QJsonObject &json_obj)
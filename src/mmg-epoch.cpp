@@ -0,0 +1,135 @@
+/*
+obs-midi-mg
+Copyright (C) 2022-2026 nhielost <nhielost@gmail.com>
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program. If not, see <https://www.gnu.org/licenses/>
+*/
+
+#include "mmg-epoch.h"
+
+#include <QThread>
+#include <QTimer>
+
+#include <vector>
+
+namespace MMGEpoch {
+
+struct Retired {
+	uint64_t epoch;
+	std::function<void()> reclaim;
+};
+
+// Readers count themselves under the parity of the epoch they entered in.
+// The epoch only advances once the readers of the previous epoch (same parity as the next one) have left,
+// so anything retired during an epoch is unreachable once the epoch after it has no readers left from before
+static std::atomic_uint64_t epoch = 0;
+static std::atomic_int64_t readers[2] {};
+
+static std::vector<Retired> retired;
+static QTimer *collector = nullptr;
+
+static void schedule()
+{
+	if (!collector->isActive()) collector->start();
+}
+
+// ReadGuard
+ReadGuard::ReadGuard()
+{
+	while (true) {
+		uint64_t current = epoch.load();
+		parity = uint8_t(current & 1);
+		++readers[parity];
+
+		if (epoch.load() == current) break;
+		--readers[parity];
+	}
+}
+
+ReadGuard::ReadGuard(const ReadGuard &other) : parity(other.parity)
+{
+	// The other guard keeps this parity occupied, so the epoch cannot have moved past it
+	++readers[parity];
+}
+
+ReadGuard::~ReadGuard()
+{
+	--readers[parity];
+}
+// End ReadGuard
+
+void init()
+{
+	collector = new QTimer;
+	collector->setSingleShot(true);
+	collector->setInterval(10);
+	QObject::connect(collector, &QTimer::timeout, collect);
+}
+
+void retire(std::function<void()> reclaim)
+{
+	// Before init and after release, no readers are left to wait for
+	if (!collector) {
+		reclaim();
+		return;
+	}
+
+	if (QThread::currentThread() != collector->thread()) {
+		QMetaObject::invokeMethod(
+			collector, [reclaim = std::move(reclaim)]() mutable { retire(std::move(reclaim)); },
+			Qt::QueuedConnection);
+		return;
+	}
+
+	retired.push_back({epoch.load(), std::move(reclaim)});
+	schedule();
+}
+
+void collect()
+{
+	uint64_t current = epoch.load();
+	if (readers[(current + 1) & 1].load() != 0) {
+		schedule();
+		return;
+	}
+
+	std::vector<Retired> reclaimable;
+	std::erase_if(retired, [&](Retired &value) {
+		if (value.epoch >= current) return false;
+		reclaimable.push_back(std::move(value));
+		return true;
+	});
+	epoch = current + 1;
+
+	// Reclaiming may retire more (e.g. a binding retiring its actions)
+	for (Retired &value : reclaimable)
+		value.reclaim();
+
+	if (!retired.empty()) schedule();
+}
+
+void release()
+{
+	while (!retired.empty()) {
+		std::vector<Retired> reclaimable;
+		reclaimable.swap(retired);
+		for (Retired &value : reclaimable)
+			value.reclaim();
+	}
+
+	delete collector;
+	collector = nullptr;
+}
+
+} // namespace MMGEpoch
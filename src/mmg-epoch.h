@@ -0,0 +1,78 @@
+/*
+obs-midi-mg
+Copyright (C) 2022-2026 nhielost <nhielost@gmail.com>
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program. If not, see <https://www.gnu.org/licenses/>
+*/
+
+#ifndef MMG_EPOCH_H
+#define MMG_EPOCH_H
+
+#include <atomic>
+#include <functional>
+
+// Epoch-based reclamation for data that is edited on the main thread and read everywhere else:
+//   - readers hold a ReadGuard while using published data, and never take a lock
+//   - the main thread publishes replacements and retires whatever they replaced
+//   - retired data is reclaimed once every reader that could have seen it has left
+namespace MMGEpoch {
+
+class ReadGuard {
+public:
+	ReadGuard();
+	ReadGuard(const ReadGuard &other);
+	~ReadGuard();
+
+	ReadGuard &operator=(const ReadGuard &) = delete;
+
+private:
+	uint8_t parity;
+};
+
+// Creates the collector, so it must be called on the main thread
+void init();
+
+// Retired data is collected on the main thread, and retiring from any other thread is handed over to it
+void retire(std::function<void()> reclaim);
+template <typename T> void retire(T *value)
+{
+	retire([value]() { delete value; });
+};
+
+void collect();
+void release();
+
+template <typename T> class Published {
+public:
+	Published() = default;
+	Published(const Published &) = delete;
+	~Published() { delete current.load(); };
+
+	// The result is only valid while a ReadGuard is held
+	const T *load() const { return current.load(); };
+
+	// Main thread only
+	void publish(const T *value)
+	{
+		const T *old = current.exchange(value);
+		if (!!old) retire(old);
+	};
+
+private:
+	std::atomic<const T *> current = nullptr;
+};
+
+} // namespace MMGEpoch
+
+#endif // MMG_EPOCH_H
@@ -18,6 +18,7 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 
 #include "mmg-json.h"
 
+#include <QCborMap>
 #include <QColor>
 #include <QDir>
 #include <QFont>
@@ -121,4 +122,18 @@ QJsonObject toObject(const char *str)
 	return toObject(QByteArray(str));
 }
 
+QByteArray toBinary(const QJsonObject &json_obj)
+{
+	return QCborValue::fromJsonValue(json_obj).toCbor();
+}
+
+QJsonObject fromBinary(const QByteArray &data, QString *error)
+{
+	QCborParserError parse_err;
+	QCborValue value = QCborValue::fromCbor(data, &parse_err);
+	if (error) *error = parse_err.error != QCborError::NoError ? parse_err.errorString() : QString();
+
+	return value.isMap() ? value.toMap().toJsonObject() : QJsonObject();
+}
+
 } // namespace MMGJson
@@ -22,6 +22,7 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 #include "mmg-string.h"
 #include "obs-midi-mg.h"
 
+#include <QCborValue>
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QJsonObject>
@@ -71,6 +72,9 @@ QByteArray toString(const QJsonObject &json_obj);
 QJsonObject toObject(const QByteArray &str);
 QJsonObject toObject(const char *str);
 
+QByteArray toBinary(const QJsonObject &json_obj);
+QJsonObject fromBinary(const QByteArray &data, QString *error = nullptr);
+
 template <typename T> inline T getValue(const QJsonObject &json_obj, const char *key)
 {
 	return convertTo<T>(json_obj[key]);
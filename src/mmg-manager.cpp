@@ -19,20 +19,70 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 #include "mmg-manager.h"
 #include "mmg-config.h"
 
+#include <QThread>
+
+// Bindings execute from a snapshot of their messages and actions, which follows every change to them
+template <class T> static void publish(const MMGManager<T> *manager)
+{
+	if constexpr (std::is_same_v<T, MMGMessage> || std::is_same_v<T, MMGAction>) {
+		auto *binding = qobject_cast<MMGBinding *>(manager->parent());
+		if (!!binding) binding->publish();
+	}
+}
+
+// Removed values stop receiving right away,
+// but anything a running binding may still be reading is only reclaimed once it is done
+template <class T> static void release(const MMGManager<T> *manager, T *value)
+{
+	if constexpr (std::is_same_v<T, MMGMessage>) {
+		value->connectDevice(false);
+		if (!!value->device()) value->device()->editReceiver(value, false);
+		QObject::disconnect(value, nullptr, manager->parent(), nullptr);
+	} else if constexpr (std::is_same_v<T, MMGAction>) {
+		value->connectSignal(false);
+		QObject::disconnect(value, nullptr, manager->parent(), nullptr);
+	} else if constexpr (std::is_same_v<T, MMGBinding>) {
+		value->setConnected(false);
+	} else if constexpr (std::is_same_v<T, MMGBindingManager>) {
+		for (MMGBinding *binding : *value)
+			binding->setConnected(false);
+	}
+
+	if constexpr (std::is_same_v<T, MMGMessage> || std::is_same_v<T, MMGAction> || std::is_same_v<T, MMGBinding> ||
+		      std::is_same_v<T, MMGBindingManager>) {
+		value->setParent(nullptr);
+		MMGEpoch::retire(value);
+	} else {
+		delete value;
+	}
+}
+
+// Values that can be duplicated directly, rather than through their JSON
+template <class T>
+concept Cloneable = requires(MMGManager<T> *parent, const T *source) {
+	{ T::clone(parent, source) } -> std::same_as<T *>;
+};
+
 template <class T> T *MMGManager<T>::add(T *new_t)
 {
 	if (!new_t) return nullptr;
+	materialize();
 	_list.append(new_t);
 	new_t->setParent(this);
 	if (!new_t->objectName().isEmpty() && find(new_t->objectName()) != new_t) setUniqueName(new_t);
+	publish(this);
 	return new_t;
 }
 
 template <class T> T *MMGManager<T>::copy(T *source)
 {
-	QJsonObject json_obj;
-	source->json(json_obj);
-	return copy(source, add(json_obj));
+	if constexpr (Cloneable<T>) {
+		return add(T::clone(this, source));
+	} else {
+		QJsonObject json_obj;
+		source->json(json_obj);
+		return copy(source, add(json_obj));
+	}
 }
 
 template <class T> T *MMGManager<T>::copy(T *source, T *dest)
@@ -44,6 +94,7 @@ template <class T> T *MMGManager<T>::copy(T *source, T *dest)
 
 template <class T> T *MMGManager<T>::find(const QString &name) const
 {
+	materialize();
 	for (T *value : _list) {
 		if (value->objectName() == name) return value;
 	}
@@ -52,8 +103,10 @@ template <class T> T *MMGManager<T>::find(const QString &name) const
 
 template <class T> void MMGManager<T>::move(int from, int to)
 {
+	materialize();
 	if (from >= _list.size()) return;
 	to >= _list.size() ? _list.append(_list.takeAt(from)) : _list.move(from, to);
+	publish(this);
 }
 
 template <class T> void MMGManager<T>::setUniqueName(T *source, qulonglong count)
@@ -69,6 +122,7 @@ template <class T> void MMGManager<T>::setUniqueName(T *source, qulonglong count
 template <class T> const MMGTranslationMap<T *> MMGManager<T>::names() const
 {
 	MMGTranslationMap<T *> names;
+	materialize();
 	for (T *val : _list)
 		names.insert(val, nontr(qUtf8Printable(val->objectName())));
 	return names;
@@ -76,14 +130,20 @@ template <class T> const MMGTranslationMap<T *> MMGManager<T>::names() const
 
 template <class T> void MMGManager<T>::remove(T *source)
 {
+	materialize();
 	_list.removeOne(source);
-	delete source;
+	publish(this);
+	release(this, source);
 }
 
 template <class T> void MMGManager<T>::clear(bool full)
 {
-	qDeleteAll(_list);
-	_list.clear();
+	pending = {};
+	QList<T *> removed;
+	removed.swap(_list);
+	publish(this);
+	for (T *value : removed)
+		release(this, value);
 	if (!full) add();
 }
 
@@ -95,8 +155,42 @@ template <class T> void MMGManager<T>::load(const QJsonObject &json_obj)
 	if (size() < 1) add();
 }
 
+template <class T> void MMGManager<T>::defer(const QJsonObject &json_obj)
+{
+	// Values are only generated once they are first accessed
+	pending = json_obj[key].toArray();
+	if (pending.isEmpty()) load(json_obj);
+}
+
+template <class T> void MMGManager<T>::materialize() const
+{
+	if (pending.isEmpty()) return;
+
+	// Generating values creates and connects QObjects, so it is never done from another thread
+	Q_ASSERT_X(QThread::currentThread() == thread(), "MMGManager::materialize",
+		   "Deferred values must be generated on the manager's thread");
+
+	QJsonArray json_arr;
+	json_arr.swap(pending);
+
+	QJsonObject json_obj;
+	json_obj[key] = json_arr;
+	const_cast<MMGManager<T> *>(this)->load(json_obj);
+
+	// Deferred bindings were skipped when the configuration finished loading
+	if constexpr (std::is_same_v<T, MMGBinding>) {
+		for (MMGBinding *binding : _list)
+			binding->refresh();
+	}
+}
+
 template <class T> void MMGManager<T>::json(QJsonObject &json_obj) const
 {
+	if (deferred()) {
+		json_obj[key] = pending;
+		return;
+	}
+
 	QJsonArray json_arr;
 	for (T *value : _list) {
 		QJsonObject value_json;
@@ -112,10 +206,19 @@ template <class T> void MMGManager<T>::copy(MMGManager<T> *dest) const
 	dest->setObjectName(objectName());
 
 	dest->clear();
+	materialize();
 	for (T *value : _list)
 		dest->copy(value);
 }
 
+template <class T>
+MMGManager<T> *MMGManager<T>::clone(MMGManager<MMGManager<T>> *parent, const MMGManager<T> *source)
+{
+	auto *dest = new MMGManager<T>(parent, source->key);
+	source->copy(dest);
+	return dest;
+}
+
 template class MMGManager<MMGMessage>;
 template class MMGManager<MMGAction>;
 template class MMGManager<MMGBinding>;
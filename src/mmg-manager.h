@@ -29,30 +29,34 @@ public:
 	~MMGManager() { clear(); };
 
 	T *add(const QJsonObject &json_obj = QJsonObject()) { return add(T::generate(this, json_obj)); };
+	T *add(T *new_t);
 
 	T *copy(T *source);
+	void copy(MMGManager<T> *dest) const;
 	T *find(const QString &name) const;
 	void move(int from, int to);
 	void remove(T *source);
 	void clear(bool full = true);
 
 	void load(const QJsonObject &json_obj);
+	void defer(const QJsonObject &json_obj);
 	void json(QJsonObject &json_obj) const;
 	void setUniqueName(T *source, qulonglong count = 2);
 	const MMGTranslationMap<T *> names() const;
 
-	T *at(qsizetype i) const { return _list.value(i); };
-	qsizetype indexOf(T *source) const { return _list.indexOf(source); };
-	qsizetype size() const { return _list.size(); };
+	T *at(qsizetype i) const { materialize(); return _list.value(i); };
+	qsizetype indexOf(T *source) const { materialize(); return _list.indexOf(source); };
+	qsizetype size() const { materialize(); return _list.size(); };
+	bool deferred() const { return !pending.isEmpty(); };
 
-	auto begin() const { return _list.begin(); };
-	auto end() const { return _list.end(); };
+	auto begin() const { materialize(); return _list.begin(); };
+	auto end() const { materialize(); return _list.end(); };
+
+	static MMGManager<T> *clone(MMGManager<MMGManager<T>> *parent, const MMGManager<T> *source);
 
 protected:
-	T *add(T *new_t);
 	T *copy(T *source, T *dest);
-
-	void copy(MMGManager<T> *dest) const;
+	void materialize() const;
 
 	static MMGManager<T> *generate(MMGManager<MMGManager<T>> *, const QJsonObject &) { return nullptr; };
 
@@ -60,6 +64,8 @@ private:
 	QList<T *> _list;
 	const char *key;
 
+	mutable QJsonArray pending;
+
 	friend class MMGManager<MMGManager<T>>;
 };
 
@@ -22,5 +22,6 @@ MMGMapping::Tester &MMGMapping::Tester::operator=(const MMGMapping::Tester &othe
 {
 	results = other.results;
 	_valid = other._valid;
+	completion = other.completion;
 	return *this;
 }
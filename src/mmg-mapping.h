@@ -24,14 +24,24 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 
 namespace MMGMapping {
 
+// Called once the actions of a fulfilled test have run, so that injected input can be followed all the way through
+using Completion = std::shared_ptr<const std::function<void()>>;
+
 class Tester {
 public:
-	Tester() {};
+	Tester() : completion(injecting) {};
 	Tester(const Tester &other) { *this = other; };
 	Tester &operator=(const Tester &other);
 
 	bool valid() const { return _valid; };
 
+	void complete() const
+	{
+		if (!!completion) (*completion)();
+	};
+	// Tests started on this thread carry the completion until it is reset
+	static void setInjecting(const Completion &completion) { injecting = completion; };
+
 	template <typename T, typename U = T>
 	requires std::convertible_to<U, T> void addAcceptable(const MMGValue<T> &value, const U &test,
 							      bool use_if = true)
@@ -94,6 +104,9 @@ public:
 private:
 	QList<int64_t> results;
 	bool _valid = true;
+	Completion completion;
+
+	static inline thread_local Completion injecting;
 };
 
 template <typename T> struct Fulfiller {
@@ -0,0 +1,126 @@
+/*
+obs-midi-mg
+Copyright (C) 2022-2026 nhielost <nhielost@gmail.com>
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program. If not, see <https://www.gnu.org/licenses/>
+*/
+
+#include "mmg-midi-conditions.h"
+
+#include <bit>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MMG_CONDITIONS_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace MMGMIDIConditions {
+
+static constexpr qsizetype lanes = 16;
+
+// Padding rows can never match: no status code has its low nibble set
+static constexpr uint8_t padding_status = 0x01;
+
+#ifdef MMG_CONDITIONS_SSE2
+static inline __m128i inRange(__m128i value, const uint8_t *min, const uint8_t *max)
+{
+	__m128i lower = _mm_loadu_si128(reinterpret_cast<const __m128i *>(min));
+	__m128i upper = _mm_loadu_si128(reinterpret_cast<const __m128i *>(max));
+	return _mm_and_si128(_mm_cmpeq_epi8(_mm_max_epu8(value, lower), value),
+			     _mm_cmpeq_epi8(_mm_min_epu8(value, upper), value));
+}
+#endif
+
+// Table
+void Table::add(MMGMessageReceiver *rec, bool always)
+{
+	Row row;
+	if (always || !rec->compileConditions(row)) {
+		fallback += rec;
+		return;
+	}
+
+	addRow(row);
+	receivers += rec;
+}
+
+void Table::addRow(const Row &row)
+{
+	qsizetype i = receivers.size();
+	if (i % lanes == 0) {
+		status.resize(i + lanes, padding_status);
+		group_min.resize(i + lanes, 0xff);
+		group_max.resize(i + lanes, 0x00);
+		channel_min.resize(i + lanes, 0xff);
+		channel_max.resize(i + lanes, 0x00);
+		index_min.resize(i + lanes, 0xff);
+		index_max.resize(i + lanes, 0x00);
+	}
+
+	status[i] = row.status;
+	group_min[i] = row.group_min;
+	group_max[i] = row.group_max;
+	channel_min[i] = row.channel_min;
+	channel_max[i] = row.channel_max;
+	index_min[i] = row.index_min;
+	index_max[i] = row.index_max;
+}
+
+uint32_t Table::matchLanes(qsizetype offset, const Row &message) const
+{
+#ifdef MMG_CONDITIONS_SSE2
+	__m128i result = _mm_cmpeq_epi8(_mm_set1_epi8(char(message.status)),
+					_mm_loadu_si128(reinterpret_cast<const __m128i *>(&status[offset])));
+	result = _mm_and_si128(result, inRange(_mm_set1_epi8(char(message.group_min)), &group_min[offset],
+					       &group_max[offset]));
+	result = _mm_and_si128(result, inRange(_mm_set1_epi8(char(message.channel_min)), &channel_min[offset],
+					       &channel_max[offset]));
+	result = _mm_and_si128(result, inRange(_mm_set1_epi8(char(message.index_min)), &index_min[offset],
+					       &index_max[offset]));
+	return uint32_t(_mm_movemask_epi8(result));
+#else
+	uint32_t result = 0;
+	for (qsizetype i = 0; i < lanes; ++i) {
+		qsizetype row = offset + i;
+		bool matched = status[row] == message.status;
+		matched &= group_min[row] <= message.group_min && message.group_min <= group_max[row];
+		matched &= channel_min[row] <= message.channel_min && message.channel_min <= channel_max[row];
+		matched &= index_min[row] <= message.index_min && message.index_min <= index_max[row];
+		result |= uint32_t(matched) << i;
+	}
+	return result;
+#endif
+}
+
+void Table::match(const MMGMessageData &message, Matches &matches) const
+{
+	if (!receivers.isEmpty()) {
+		// The message's own fields, as a single-value row
+		Row fields;
+		fields.status = message.status();
+		fields.group_min = uint8_t(message.get<4, 4>());
+		fields.channel_min = uint8_t(message.get<12, 4>());
+		fields.index_min = uint8_t(message.get<16, 8>());
+
+		for (qsizetype offset = 0; offset < qsizetype(status.size()); offset += lanes) {
+			for (uint32_t mask = matchLanes(offset, fields); mask != 0; mask &= mask - 1)
+				matches += receivers[offset + std::countr_zero(mask)];
+		}
+	}
+
+	matches.append(fallback.constData(), fallback.size());
+}
+// End Table
+
+} // namespace MMGMIDIConditions
@@ -0,0 +1,69 @@
+/*
+obs-midi-mg
+Copyright (C) 2022-2026 nhielost <nhielost@gmail.com>
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program. If not, see <https://www.gnu.org/licenses/>
+*/
+
+#ifndef MMG_MIDI_CONDITIONS_H
+#define MMG_MIDI_CONDITIONS_H
+
+#include "messages/mmg-message-data.h"
+
+#include <QVarLengthArray>
+
+namespace MMGMIDIConditions {
+
+// Bounds on the fields shared by every channel voice packet layout
+// (group and channel are zero-based, index is the byte after the status)
+struct Row {
+	uint8_t status = 0;
+	uint8_t group_min = 0x00;
+	uint8_t group_max = 0xff;
+	uint8_t channel_min = 0x00;
+	uint8_t channel_max = 0xff;
+	uint8_t index_min = 0x00;
+	uint8_t index_max = 0xff;
+};
+
+using Matches = QVarLengthArray<MMGMessageReceiver *, 64>;
+
+// Receivers' conditions stored column-wise, so a message can be tested against many rows at once.
+// This only rules receivers out; the ones that match still run their full test
+class Table {
+public:
+	void add(MMGMessageReceiver *rec, bool always = false);
+	qsizetype size() const { return receivers.size() + fallback.size(); };
+
+	void match(const MMGMessageData &message, Matches &matches) const;
+
+private:
+	void addRow(const Row &row);
+	uint32_t matchLanes(qsizetype offset, const Row &message) const;
+
+	std::vector<uint8_t> status;
+	std::vector<uint8_t> group_min;
+	std::vector<uint8_t> group_max;
+	std::vector<uint8_t> channel_min;
+	std::vector<uint8_t> channel_max;
+	std::vector<uint8_t> index_min;
+	std::vector<uint8_t> index_max;
+
+	QList<MMGMessageReceiver *> receivers;
+	QList<MMGMessageReceiver *> fallback;
+};
+
+} // namespace MMGMIDIConditions
+
+#endif // MMG_MIDI_CONDITIONS_H
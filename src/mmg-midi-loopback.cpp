@@ -0,0 +1,113 @@
+/*
+obs-midi-mg
+Copyright (C) 2022-2026 nhielost <nhielost@gmail.com>
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program. If not, see <https://www.gnu.org/licenses/>
+*/
+
+#include "mmg-midi-loopback.h"
+
+#include <QJsonObject>
+
+namespace MMGMIDILoopback {
+
+static MMGMessageData midi1Message(uint8_t status, uint8_t channel, uint8_t data1, uint8_t data2)
+{
+	MMGMessageData message;
+	message.set<0, 4>(MMGMessages::MIDI1_CV);
+	message.set<8, 8>(status | ((channel - 1) & 0x0f));
+	message.set<16, 8>(data1 & 0x7f);
+	message.set<24, 8>(data2 & 0x7f);
+	return message;
+}
+
+// Settings
+Settings::Settings(const QJsonObject &json_obj)
+{
+	pattern = Pattern(std::clamp(json_obj["pattern"].toInt(), int(NONE), int(PITCH_BEND)));
+	channel = std::clamp(json_obj["channel"].toInt(1), 1, 16);
+	control = std::clamp(json_obj["control"].toInt(1), 0, 127);
+	rate = std::max(json_obj["rate"].toInt(1000), 0);
+	count = std::max<qint64>(json_obj["count"].toInteger(), 0);
+}
+
+void Settings::json(QJsonObject &json_obj) const
+{
+	json_obj["pattern"] = pattern;
+	json_obj["channel"] = channel;
+	json_obj["control"] = control;
+	json_obj["rate"] = qint64(rate);
+	json_obj["count"] = qint64(count);
+}
+// End Settings
+
+MMGMessageData generate(const Settings &settings, uint64_t index)
+{
+	switch (settings.pattern) {
+		case CC_SWEEP: {
+			// 0 -> 127 -> 0 triangle
+			uint8_t value = index % 254;
+			return midi1Message(MMGMessages::CONTROL_CHANGE, settings.channel, settings.control,
+					    value < 128 ? value : 254 - value);
+		}
+
+		case NOTE_STORM: {
+			// Alternating on / off pairs, walking the note range in fifths
+			uint8_t note = settings.control + (index / 2 * 7) % (128 - settings.control);
+			return index % 2 == 0 ? midi1Message(MMGMessages::NOTE_ON, settings.channel, note, 100)
+					      : midi1Message(MMGMessages::NOTE_OFF, settings.channel, note, 0);
+		}
+
+		case PITCH_BEND: {
+			// Full 14-bit sweep in steps of 64
+			uint16_t value = (index * 64) % 16384;
+			return midi1Message(MMGMessages::PITCH_BEND, settings.channel, value & 0x7f, value >> 7);
+		}
+
+		default:
+			return MMGMessageData();
+	}
+}
+
+// Generator
+Generator::Generator(const Settings &settings, const Sink &sink)
+	: settings(settings),
+	  sink(sink),
+	  thread(&Generator::run, this)
+{
+}
+
+Generator::~Generator()
+{
+	stopping = true;
+	if (thread.joinable()) thread.join();
+}
+
+void Generator::run()
+{
+	auto start = std::chrono::steady_clock::now();
+
+	for (uint64_t i = 0; !stopping && (settings.count == 0 || i < settings.count); ++i) {
+		if (settings.rate > 0)
+			std::this_thread::sleep_until(start + std::chrono::nanoseconds(i * 1000000000ull / settings.rate));
+
+		sink(generate(settings, i));
+		++_sent;
+	}
+
+	running = false;
+}
+// End Generator
+
+} // namespace MMGMIDILoopback
@@ -0,0 +1,72 @@
+/*
+obs-midi-mg
+Copyright (C) 2022-2026 nhielost <nhielost@gmail.com>
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program. If not, see <https://www.gnu.org/licenses/>
+*/
+
+#ifndef MMG_MIDI_LOOPBACK_H
+#define MMG_MIDI_LOOPBACK_H
+
+#include "messages/mmg-message-data.h"
+
+#include <atomic>
+#include <thread>
+
+namespace MMGMIDILoopback {
+
+enum Pattern { NONE, CC_SWEEP, NOTE_STORM, PITCH_BEND };
+
+struct Settings {
+	Settings() = default;
+	Settings(const QJsonObject &json_obj);
+
+	void json(QJsonObject &json_obj) const;
+
+	Pattern pattern = NONE;
+	uint8_t channel = 1;
+	uint8_t control = 1; // CC number, or the lowest note of a note storm
+	uint32_t rate = 1000; // Messages per second, 0 for as fast as possible
+	uint64_t count = 0; // 0 to run until stopped
+};
+
+// The same settings and index always produce the same message
+MMGMessageData generate(const Settings &settings, uint64_t index);
+
+class Generator {
+public:
+	using Sink = std::function<void(const MMGMessageData &)>;
+
+	Generator(const Settings &settings, const Sink &sink);
+	~Generator();
+
+	bool isRunning() const { return running; };
+	uint64_t sent() const { return _sent; };
+
+private:
+	void run();
+
+	Settings settings;
+	Sink sink;
+
+	std::atomic_bool running = true;
+	std::atomic_bool stopping = false;
+	std::atomic_uint64_t _sent = 0;
+
+	std::thread thread;
+};
+
+} // namespace MMGMIDILoopback
+
+#endif // MMG_MIDI_LOOPBACK_H
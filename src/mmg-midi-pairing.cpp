@@ -0,0 +1,163 @@
+/*
+obs-midi-mg
+Copyright (C) 2022-2026 nhielost <nhielost@gmail.com>
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program. If not, see <https://www.gnu.org/licenses/>
+*/
+
+#include "mmg-midi-pairing.h"
+
+namespace MMGMIDIPairing {
+
+enum Controller : uint8_t {
+	DATA_ENTRY_MSB = 6,
+	DATA_ENTRY_LSB = 38,
+	NRPN_LSB = 98,
+	NRPN_MSB = 99,
+	RPN_LSB = 100,
+	RPN_MSB = 101,
+};
+
+static MMGMessageData midi1Packet(const MMGMessageData &source, uint8_t control, uint8_t value)
+{
+	MMGMessageData message;
+	message.set<0, 4>(MMGMessages::MIDI1_CV);
+	message.set<4, 4>(source.get<4, 4>());
+	message.set<8, 4>(MMGMessages::CONTROL_CHANGE >> 4);
+	message.set<12, 4>(source.get<12, 4>());
+	message.set<16, 8>(control);
+	message.set<24, 8>(value);
+	return message;
+}
+
+static MMGMessageData midi2Packet(const MMGMessageData &source, MMGMessages::ChannelStatusCode status,
+				  uint8_t byte_3, uint8_t byte_4, uint16_t value)
+{
+	MMGMessageData message;
+	message.set<0, 4>(MMGMessages::MIDI2_CV);
+	message.set<4, 4>(source.get<4, 4>());
+	message.set<8, 4>(status >> 4);
+	message.set<12, 4>(source.get<12, 4>());
+	message.set<16, 8>(byte_3);
+	message.set<24, 8>(byte_4);
+	message.set<32, 32>(scaleUp(value, 14, 32));
+	return message;
+}
+
+uint32_t scaleUp(uint32_t value, uint8_t src_bits, uint8_t dst_bits)
+{
+	uint8_t scale_bits = dst_bits - src_bits;
+	uint32_t shifted = value << scale_bits;
+	if (value <= (1u << (src_bits - 1))) return shifted;
+
+	uint8_t repeat_bits = src_bits - 1;
+	uint32_t repeat = value & ((1u << repeat_bits) - 1);
+	repeat = scale_bits > repeat_bits ? repeat << (scale_bits - repeat_bits)
+					  : repeat >> (repeat_bits - scale_bits);
+
+	while (repeat != 0) {
+		shifted |= repeat;
+		repeat >>= repeat_bits;
+	}
+
+	return shifted;
+}
+
+// Pairer
+void Pairer::setEnabled(bool controllers, bool parameters)
+{
+	if (pair_controllers == controllers && pair_parameters == parameters) return;
+
+	pair_controllers = controllers;
+	pair_parameters = parameters;
+	reset();
+}
+
+bool Pairer::process(MMGMessageData &message)
+{
+	if (!pair_controllers && !pair_parameters) return true;
+	if (message.type() != MMGMessages::MIDI1_CV || message.status() != MMGMessages::CONTROL_CHANGE) return true;
+
+	ChannelState &state = channels[message.get<12, 4>()];
+	uint8_t control = message.get<16, 8>() & 0x7f;
+	uint8_t value = message.get<24, 8>() & 0x7f;
+	bool param_selected = pair_parameters && (state.param_msb != 0x7f || state.param_lsb != 0x7f);
+	auto param_status = state.param_nrpn ? MMGMessages::NRPN : MMGMessages::RPN;
+
+	switch (control) {
+		case DATA_ENTRY_MSB:
+			if (!param_selected) break;
+
+			state.data_msb = value;
+			if (state.data_paired[state.param_nrpn]) return false;
+
+			message = midi2Packet(message, param_status, state.param_msb, state.param_lsb, value << 7);
+			return true;
+
+		case DATA_ENTRY_LSB:
+			if (!param_selected) break;
+
+			state.data_paired[state.param_nrpn] = true;
+			message = midi2Packet(message, param_status, state.param_msb, state.param_lsb,
+					      (state.data_msb << 7) | value);
+			return true;
+
+		case NRPN_LSB:
+		case NRPN_MSB:
+		case RPN_LSB:
+		case RPN_MSB:
+			if (!pair_parameters) break;
+
+			if (state.param_nrpn != (control < RPN_LSB)) {
+				state.param_nrpn = control < RPN_LSB;
+				state.param_msb = state.param_lsb = 0x7f;
+			}
+			(control % 2 == 1 ? state.param_msb : state.param_lsb) = value;
+			return false;
+
+		default:
+			if (!pair_controllers) break;
+
+			if (control < 32) {
+				state.msb_values[control] = value;
+				return !(state.paired_msb & (1u << control));
+			}
+
+			if (control < 64) {
+				uint8_t msb = control - 32;
+				state.paired_msb |= 1u << msb;
+				message = midi2Packet(message, MMGMessages::CONTROL_CHANGE, msb, 0,
+						      (state.msb_values[msb] << 7) | value);
+			}
+			break;
+	}
+
+	return true;
+}
+// End Pairer
+
+QList<MMGMessageData> expand(const MMGMessageData &message)
+{
+	bool nrpn = message.status() == MMGMessages::NRPN;
+	uint16_t value = message.get<32, 32>() >> 18;
+
+	return {
+		midi1Packet(message, nrpn ? NRPN_MSB : RPN_MSB, message.get<16, 8>()),
+		midi1Packet(message, nrpn ? NRPN_LSB : RPN_LSB, message.get<24, 8>()),
+		midi1Packet(message, DATA_ENTRY_MSB, value >> 7),
+		midi1Packet(message, DATA_ENTRY_LSB, value & 0x7f),
+	};
+}
+
+} // namespace MMGMIDIPairing
@@ -0,0 +1,70 @@
+/*
+obs-midi-mg
+Copyright (C) 2022-2026 nhielost <nhielost@gmail.com>
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program. If not, see <https://www.gnu.org/licenses/>
+*/
+
+#ifndef MMG_MIDI_PAIRING_H
+#define MMG_MIDI_PAIRING_H
+
+#include "messages/mmg-message-data.h"
+
+#include <array>
+
+namespace MMGMIDIPairing {
+
+// MIDI 2.0 Specification section D.3 (Min-Center-Max scaling)
+uint32_t scaleUp(uint32_t value, uint8_t src_bits, uint8_t dst_bits);
+
+// Assembles MIDI 1.0 controller pairs into single MIDI 2.0 packets:
+//   - MSB (0-31) + LSB (32-63) controllers become a 32-bit Control Change
+//   - (N)RPN selection + Data Entry becomes a Registered / Assignable Controller
+// An MSB is only held back once its LSB has been seen, so 7-bit controllers pass through untouched.
+// Each kind of pair is only assembled once enabled, and until then its messages pass through untouched too.
+// Pairers are not synchronized, so each one must only be used by one thread at a time
+class Pairer {
+public:
+	// Returns false if the message was absorbed into a pair that is not yet complete
+	bool process(MMGMessageData &message);
+	void reset() { channels.fill({}); };
+
+	void setEnabled(bool controllers, bool parameters);
+
+private:
+	bool pair_controllers = false;
+	bool pair_parameters = false;
+
+	struct ChannelState {
+		std::array<uint8_t, 32> msb_values {};
+		uint32_t pending_msb = 0;
+		uint32_t paired_msb = 0;
+
+		uint8_t param_msb = 0x7f;
+		uint8_t param_lsb = 0x7f;
+		bool param_nrpn = false;
+
+		uint8_t data_msb = 0;
+		std::array<bool, 2> data_paired {};
+	};
+
+	std::array<ChannelState, 16> channels;
+};
+
+// Splits a MIDI 2.0 Registered / Assignable Controller packet into its MIDI 1.0 Control Change sequence
+QList<MMGMessageData> expand(const MMGMessageData &message);
+
+} // namespace MMGMIDIPairing
+
+#endif // MMG_MIDI_PAIRING_H
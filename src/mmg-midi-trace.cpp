@@ -0,0 +1,214 @@
+/*
+obs-midi-mg
+Copyright (C) 2022-2026 nhielost <nhielost@gmail.com>
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program. If not, see <https://www.gnu.org/licenses/>
+*/
+
+#include "mmg-midi-trace.h"
+#include "mmg-mapping.h"
+
+namespace MMGMIDITrace {
+
+static constexpr char trace_magic[8] = {'M', 'M', 'G', 'T', 'R', 'A', 'C', 'E'};
+static constexpr qint64 initial_records = 4096;
+
+static qint64 align(qint64 size)
+{
+	return (size + 7) & ~qint64(7);
+}
+
+static void storeMax(std::atomic<qint64> &max, qint64 value)
+{
+	qint64 current = max;
+	while (value > current && !max.compare_exchange_weak(current, value)) {
+	}
+}
+
+// Report
+QString Report::summary() const
+{
+	return QString("%1 messages in %2 ms (%3 msg/s), %4 dropped, dispatch latency mean %5 us / max %6 us, "
+		       "%7 executions, execution latency mean %8 us / max %9 us")
+		.arg(injected)
+		.arg(elapsed / 1000000.0, 0, 'f', 2)
+		.arg(throughput(), 0, 'f', 0)
+		.arg(dropped)
+		.arg(meanLatency() / 1000.0, 0, 'f', 2)
+		.arg(max_latency / 1000.0, 0, 'f', 2)
+		.arg(executed)
+		.arg(meanExecutionLatency() / 1000.0, 0, 'f', 2)
+		.arg(max_execution_latency / 1000.0, 0, 'f', 2);
+}
+// End Report
+
+// Writer
+Writer::Writer(const QString &path, const QString &device_name) : file(path)
+{
+	if (!file.open(QIODevice::ReadWrite | QIODevice::Truncate)) return;
+
+	QByteArray name = device_name.toUtf8();
+	header_size = sizeof(Header) + align(name.size());
+	if (!reserve(header_size + initial_records * sizeof(Record))) return;
+
+	Header *header = reinterpret_cast<Header *>(data);
+	memcpy(header->magic, trace_magic, sizeof(trace_magic));
+	header->version = currentVersion();
+	header->name_size = name.size();
+	memcpy(data + sizeof(Header), name.constData(), name.size());
+
+	timer.start();
+}
+
+Writer::~Writer()
+{
+	if (!file.isOpen()) return;
+
+	if (!!data) file.unmap(data);
+	file.resize(header_size + count * sizeof(Record));
+	file.close();
+}
+
+bool Writer::reserve(qint64 size)
+{
+	if (!!data) file.unmap(data);
+
+	data = file.resize(size) ? file.map(0, size) : nullptr;
+	capacity = !!data ? size : 0;
+	return !!data;
+}
+
+void Writer::write(const MMGMessageData &message)
+{
+	if (!data) return;
+
+	qint64 offset = header_size + count * sizeof(Record);
+	if (offset + qint64(sizeof(Record)) > capacity && !reserve(capacity * 2)) return;
+
+	Record *record = reinterpret_cast<Record *>(data + offset);
+	record->time = timer.nsecsElapsed();
+	record->message = message.raw();
+	++count;
+}
+// End Writer
+
+// Reader
+Reader::Reader(const QString &path) : file(path)
+{
+	if (!file.open(QIODevice::ReadOnly) || file.size() < qint64(sizeof(Header))) return;
+
+	data = file.map(0, file.size());
+	if (!data) return;
+
+	const Header *header = reinterpret_cast<const Header *>(data);
+	if (memcmp(header->magic, trace_magic, sizeof(trace_magic)) != 0 || header->version != currentVersion())
+		return;
+
+	qint64 header_size = sizeof(Header) + align(header->name_size);
+	if (header_size > file.size()) return;
+
+	device_name = QString::fromUtf8(reinterpret_cast<const char *>(data + sizeof(Header)), header->name_size);
+	records = reinterpret_cast<const Record *>(data + header_size);
+
+	// A partial record is left by files cut short, and zeroed records by captures that never finished
+	// (no message is ever all zeros), so both are left out
+	count = (file.size() - header_size) / sizeof(Record);
+	while (count > 0 && records[count - 1].message == 0)
+		--count;
+}
+
+Reader::~Reader()
+{
+	if (!!data) file.unmap(data);
+}
+// End Reader
+
+// Replayer
+Replayer::Replayer(const QString &path, double speed, const Sink &sink, const Done &done)
+	: reader(path),
+	  speed(speed),
+	  sink(sink),
+	  done(done)
+{
+	if (!reader.isValid()) {
+		running = false;
+		return;
+	}
+
+	thread = std::thread(&Replayer::run, this);
+}
+
+Replayer::~Replayer()
+{
+	stopping = true;
+	if (thread.joinable()) thread.join();
+}
+
+void Replayer::run()
+{
+	Report report;
+
+	struct Executions {
+		QElapsedTimer timer;
+		std::atomic<qint64> count = 0;
+		std::atomic<qint64> total_latency = 0;
+		std::atomic<qint64> max_latency = 0;
+	};
+	auto executions = std::make_shared<Executions>();
+	executions->timer.start();
+	const QElapsedTimer &timer = executions->timer;
+
+	qint64 first = reader.size() > 0 ? qint64(reader.at(0).time) : 0;
+
+	for (qsizetype i = 0; i < reader.size() && !stopping; ++i) {
+		const Record &record = reader.at(i);
+
+		qint64 due = speed > 0 ? qint64(std::max<qint64>(qint64(record.time) - first, 0) / speed)
+				       : timer.nsecsElapsed();
+		qint64 ahead = due - timer.nsecsElapsed();
+		if (ahead > 0) std::this_thread::sleep_for(std::chrono::nanoseconds(ahead));
+
+		// Every test this message starts carries its due time through to its binding's run
+		MMGMapping::Tester::setInjecting(std::make_shared<const std::function<void()>>([executions, due]() {
+			qint64 latency = executions->timer.nsecsElapsed() - due;
+			++executions->count;
+			executions->total_latency += latency;
+			storeMax(executions->max_latency, latency);
+		}));
+		if (!sink(MMGMessageData(record.message))) ++report.dropped;
+		MMGMapping::Tester::setInjecting(nullptr);
+		++report.injected;
+
+		qint64 latency = timer.nsecsElapsed() - due;
+		report.total_latency += latency;
+		report.max_latency = std::max(report.max_latency, latency);
+	}
+
+	report.elapsed = timer.nsecsElapsed();
+
+	// Tests only let go of their completions once their runs are over (or they were never fulfilled)
+	qint64 deadline = timer.nsecsElapsed() + 10000000000ll;
+	while (executions.use_count() > 1 && !stopping && timer.nsecsElapsed() < deadline)
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+	report.executed = executions->count;
+	report.total_execution_latency = executions->total_latency;
+	report.max_execution_latency = executions->max_latency;
+
+	running = false;
+	if (!!done) done(report);
+}
+// End Replayer
+
+} // namespace MMGMIDITrace
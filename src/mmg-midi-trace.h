@@ -0,0 +1,143 @@
+/*
+obs-midi-mg
+Copyright (C) 2022-2026 nhielost <nhielost@gmail.com>
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program. If not, see <https://www.gnu.org/licenses/>
+*/
+
+#ifndef MMG_MIDI_TRACE_H
+#define MMG_MIDI_TRACE_H
+
+#include "messages/mmg-message-data.h"
+
+#include <QElapsedTimer>
+#include <QFile>
+
+#include <atomic>
+#include <functional>
+#include <thread>
+
+namespace MMGMIDITrace {
+
+// Trace files are a header, the UTF-8 device name (padded to 8 bytes),
+// then a flat array of records, all in native byte order
+struct Header {
+	char magic[8];
+	uint32_t version;
+	uint32_t name_size;
+};
+
+struct Record {
+	uint64_t time; // Nanoseconds since the capture started
+	uint64_t message;
+};
+
+constexpr uint32_t currentVersion() { return 1; };
+
+// Dispatch latency runs from when a message was due until the port is done with it,
+// and execution latency until the actions of each binding it fulfilled have run
+struct Report {
+	qsizetype injected = 0;
+	qsizetype dropped = 0;
+	qint64 elapsed = 0;
+	qint64 total_latency = 0;
+	qint64 max_latency = 0;
+
+	qsizetype executed = 0;
+	qint64 total_execution_latency = 0;
+	qint64 max_execution_latency = 0;
+
+	double throughput() const { return elapsed > 0 ? injected * 1e9 / elapsed : 0.0; };
+	double meanLatency() const { return injected > 0 ? double(total_latency) / injected : 0.0; };
+	double meanExecutionLatency() const
+	{
+		return executed > 0 ? double(total_execution_latency) / executed : 0.0;
+	};
+
+	QString summary() const;
+};
+
+class Writer {
+public:
+	Writer(const QString &path, const QString &device_name);
+	~Writer();
+
+	bool isOpen() const { return !!data; };
+	qsizetype size() const { return count; };
+
+	void write(const MMGMessageData &message);
+
+private:
+	bool reserve(qint64 size);
+
+	QFile file;
+	uchar *data = nullptr;
+	qint64 capacity = 0;
+	qint64 header_size = 0;
+	qsizetype count = 0;
+
+	QElapsedTimer timer;
+};
+
+class Reader {
+public:
+	Reader(const QString &path);
+	~Reader();
+
+	bool isValid() const { return !!records; };
+	const QString &deviceName() const { return device_name; };
+	qsizetype size() const { return count; };
+
+	const Record &at(qsizetype i) const { return records[i]; };
+
+private:
+	QFile file;
+	uchar *data = nullptr;
+	const Record *records = nullptr;
+	qsizetype count = 0;
+
+	QString device_name;
+};
+
+// Replays a trace on its own thread, paced by the recorded times (or as fast as possible at speed 0)
+class Replayer {
+public:
+	using Sink = std::function<bool(const MMGMessageData &)>;
+	using Done = std::function<void(const Report &)>;
+
+	Replayer(const QString &path, double speed, const Sink &sink, const Done &done);
+	~Replayer();
+
+	bool isValid() const { return reader.isValid(); };
+	bool isRunning() const { return running; };
+	const QString &deviceName() const { return reader.deviceName(); };
+	qsizetype size() const { return reader.size(); };
+
+private:
+	void run();
+
+	Reader reader;
+	double speed;
+	Sink sink;
+	Done done;
+
+	std::atomic_bool running = true;
+	std::atomic_bool stopping = false;
+
+	std::thread thread;
+};
+
+} // namespace MMGMIDITrace
+
+#endif // MMG_MIDI_TRACE_H
@@ -18,8 +18,11 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 
 #include "mmg-midi.h"
 #include "mmg-config.h"
+#include "mmg-midi-pairing.h"
 #include "mmg-preference-defs.h"
 
+#include <thread>
+
 static std::unique_ptr<libremidi::observer> observer;
 static bool api_changing = false;
 
@@ -40,6 +43,18 @@ static void backendError(std::string_view msg, const libremidi::source_location
 		 QString("Debug Info: %1 at %2:%3").arg(loc.function_name()).arg(loc.file_name()).arg(loc.line()));
 }
 
+// Bindings are matched against messages in the protocol of the message mode, whatever the source delivers
+static MMGMessages::Type messageMode()
+{
+	return MMGMessages::usingMIDI2() ? MMGMessages::MIDI2_CV : MMGMessages::MIDI1_CV;
+}
+
+static bool isUMPAPI(libremidi_api api)
+{
+	auto ump_apis = libremidi::available_ump_apis();
+	return std::find(ump_apis.begin(), ump_apis.end(), api) != ump_apis.end();
+}
+
 static QString getPortDisplayName(const libremidi::port_information &pi)
 {
 	switch (getCurrentAPI()) {
@@ -153,6 +168,9 @@ void resetMIDIAPI(libremidi_api api)
 		},
 		api));
 
+	if (qEnvironmentVariableIsSet("OBS_MIDIMG_LOOPBACK") && !manager(device)->find("Loopback"))
+		addLoopbackDevice(MMGMIDILoopback::Pattern(qEnvironmentVariableIntValue("OBS_MIDIMG_LOOPBACK")));
+
 	for (MMGDevice *device : *manager(device))
 		device->refreshPort();
 
@@ -160,10 +178,34 @@ void resetMIDIAPI(libremidi_api api)
 	emit config() -> midiStateChanged();
 }
 
+// Lets the binding engine be driven without any MIDI hardware or drivers
+MMGMIDIPort *addLoopbackDevice(MMGMIDILoopback::Pattern pattern)
+{
+	QString name = "Loopback";
+	for (int i = 2; !!manager(device)->find(name); ++i)
+		name = QString("Loopback %1").arg(i);
+
+	QJsonObject generator_obj;
+	generator_obj["pattern"] = pattern;
+
+	QJsonObject json_obj;
+	json_obj["name"] = name;
+	json_obj["loopback"] = true;
+	json_obj["generator"] = generator_obj;
+
+	MMGDevice *device = manager(device)->add(json_obj);
+	if (!!device) midiblog(LOG_INFO, QString("Device <%1> created.").arg(name));
+	return device;
+}
+
 // MMGMIDIPort
 MMGMIDIPort::MMGMIDIPort(QObject *parent, const QJsonObject &json_obj) : QObject(parent)
 {
 	setObjectName(json_obj["name"].toString(mmgtr("Device.Dummy")));
+
+	pair_controllers = json_obj["pair_controllers"].toBool(false);
+	loopback = json_obj["loopback"].toBool();
+	if (loopback) generator_settings = MMGMIDILoopback::Settings(json_obj["generator"].toObject());
 }
 
 void MMGMIDIPort::blog(int log_status, const QString &_message) const
@@ -175,6 +217,13 @@ void MMGMIDIPort::openPort(DeviceType type)
 {
 	if (!isCapable(type)) return;
 
+	if (loopback) {
+		loopback_open |= type == TYPE_OUTPUT ? 0b10 : 0b01;
+		if (type != TYPE_OUTPUT && generator_settings.pattern != MMGMIDILoopback::NONE)
+			startGenerator(generator_settings);
+		return;
+	}
+
 	switch (type) {
 		case TYPE_INPUT:
 		default:
@@ -199,6 +248,12 @@ void MMGMIDIPort::closePort(DeviceType type)
 {
 	if (!isCapable(type)) return;
 
+	if (loopback) {
+		loopback_open &= type == TYPE_OUTPUT ? 0b01 : 0b10;
+		if (type != TYPE_OUTPUT) stopGenerator();
+		return;
+	}
+
 	switch (type) {
 		case TYPE_INPUT:
 		default:
@@ -217,6 +272,8 @@ void MMGMIDIPort::closePort(DeviceType type)
 
 bool MMGMIDIPort::isPortOpen(DeviceType type) const
 {
+	if (loopback) return loopback_open & (type == TYPE_OUTPUT ? 0b10 : 0b01);
+
 	switch (type) {
 		case TYPE_INPUT:
 		default:
@@ -229,6 +286,8 @@ bool MMGMIDIPort::isPortOpen(DeviceType type) const
 
 bool MMGMIDIPort::isCapable(DeviceType type) const
 {
+	if (loopback) return true;
+
 	switch (type) {
 		case TYPE_INPUT:
 			return bool(in_port_info);
@@ -249,23 +308,81 @@ QString MMGMIDIPort::status(DeviceType type) const
 
 void MMGMIDIPort::connectReceiver(MMGMessageReceiver *rec, bool connect)
 {
+	std::scoped_lock lock(input_mutex);
+
 	if (connect) {
 		if (!recs.contains(rec)) recs += rec;
 	} else {
 		recs.removeOne(rec);
 	}
+
+	uint16_t filter = 0;
+	for (auto *rec : recs)
+		filter |= rec->statusMask();
+	status_filter = filter;
+
+	refreshPairing();
+	rebuildConditions();
+}
+
+void MMGMIDIPort::editReceiver(MMGMessageReceiver *rec, bool edit)
+{
+	std::scoped_lock lock(input_mutex);
+
+	if (edit) {
+		edited_rec = rec;
+	} else if (edited_rec == rec) {
+		edited_rec = nullptr;
+	}
+
+	rebuildConditions();
+}
+
+void MMGMIDIPort::refreshPairing()
+{
+	// (N)RPN sequences are only assembled while a binding listens for them
+	constexpr uint16_t parameter_mask = (1 << (MMGMessages::RPN >> 4)) | (1 << (MMGMessages::NRPN >> 4));
+	pairing.setEnabled(pair_controllers, !!(status_filter & parameter_mask));
+}
+
+void MMGMIDIPort::rebuildConditions()
+{
+	auto table = std::make_shared<MMGMIDIConditions::Table>();
+	for (auto *rec : recs)
+		table->add(rec, rec == edited_rec);
+
+	std::scoped_lock lock(conditions_mutex);
+	conditions = table;
+}
+
+bool MMGMIDIPort::acceptsStatus(uint8_t status) const
+{
+	// Listening, throughput and tracing need every channel voice message
+	if (!!blocking_rec || !!_thru || tracing) return true;
+	return status_filter & (1 << (status >> 4));
 }
 
 void MMGMIDIPort::sendMessage(const MMGMessageData &midi) const
 {
+	if (loopback) {
+		if (isPortOpen(TYPE_OUTPUT)) ++loopback_captured;
+		return;
+	}
+
 	if (!midi_out->is_port_open()) {
 		blog(LOG_INFO, "Cannot send message: Output device is not connected. "
 			       "(Is the output device enabled?)");
 		return;
 	}
 
-	if (MMGMessages::usingMIDI2()) {
+	// Messages are converted to the port's protocol by MMGMessageData on the way out,
+	// which only repacks messages already in it
+	if (_protocol == MMGMessages::MIDI2_CV) {
 		midi_out->send_ump(midi);
+	} else if (midi.type() == MMGMessages::MIDI2_CV &&
+		   (midi.status() == MMGMessages::RPN || midi.status() == MMGMessages::NRPN)) {
+		for (const MMGMessageData &control : MMGMIDIPairing::expand(midi))
+			midi_out->send_message(control);
 	} else {
 		midi_out->send_message(midi);
 	}
@@ -273,21 +390,51 @@ void MMGMIDIPort::sendMessage(const MMGMessageData &midi) const
 
 void MMGMIDIPort::refreshPortAPI()
 {
-	if (MMGMessages::usingMIDI2()) {
+	// Compiled conditions depend on the message mode
+	{
+		std::scoped_lock lock(input_mutex);
+		rebuildConditions();
+	}
+	if (loopback) return;
+
+	// Ports are opened in the API's native protocol so that libremidi never converts,
+	// and the callback converts only what differs from the message mode
+	_protocol = isUMPAPI(getCurrentAPI()) ? MMGMessages::MIDI2_CV : MMGMessages::MIDI1_CV;
+
+	if (_protocol == MMGMessages::MIDI2_CV) {
 		midi_in.reset(new libremidi::midi_in(
 			{
-				.on_message = [this](libremidi::ump &&incoming) { callback(MMGMessageData(incoming)); },
+				.on_message =
+					[this](libremidi::ump &&incoming) {
+						// Only Channel Voice packets are ever used
+						uint8_t type = incoming[0] >> 28;
+						if (type != MMGMessages::MIDI1_CV && type != MMGMessages::MIDI2_CV) return;
+						if (!acceptsStatus(incoming[0] >> 16)) return;
+
+						callback(MMGMessageData(incoming));
+					},
 				.on_error = backendError,
 				.on_warning = backendError,
+				.ignore_sysex = true,
+				.ignore_timing = true,
+				.ignore_sensing = true,
 			},
 			getCurrentAPI()));
 	} else {
 		midi_in.reset(new libremidi::midi_in(
 			{
 				.on_message =
-					[this](libremidi::message &&incoming) { callback(MMGMessageData(incoming)); },
+					[this](libremidi::message &&incoming) {
+						if (incoming.size() == 0 || incoming[0] >= 0xf0) return;
+						if (!acceptsStatus(incoming[0])) return;
+
+						callback(MMGMessageData(incoming));
+					},
 				.on_error = backendError,
 				.on_warning = backendError,
+				.ignore_sysex = true,
+				.ignore_timing = true,
+				.ignore_sensing = true,
 			},
 			getCurrentAPI()));
 	}
@@ -310,24 +457,135 @@ void MMGMIDIPort::setThru(MMGMIDIPort *device)
 	connect(_thru, &QObject::destroyed, this, [&]() { _thru = nullptr; });
 }
 
+void MMGMIDIPort::setPairControllers(bool pair)
+{
+	std::scoped_lock lock(input_mutex);
+	pair_controllers = pair;
+	refreshPairing();
+}
+
 void MMGMIDIPort::sendThru(const MMGMessageData &incoming)
 {
 	if (!_thru) return;
 	_thru->sendMessage(incoming);
 }
 
-void MMGMIDIPort::callback(const MMGMessageData &incoming)
+void MMGMIDIPort::startGenerator(const MMGMIDILoopback::Settings &settings)
 {
-	if (!incoming.isCV()) return; // Only using Channel Voice Messages
+	if (!loopback) return;
+
+	stopGenerator();
+	// Generated messages are MIDI 1.0, and are converted like those of any other MIDI 1.0 port
+	generator.reset(new MMGMIDILoopback::Generator(settings, [this](const MMGMessageData &incoming) {
+		if (isPortOpen(TYPE_INPUT)) callback(incoming);
+	}));
+	blog(LOG_INFO, "Loopback generator started.");
+}
 
-	if (!!blocking_rec) {
-		blocking_rec->processMessage(incoming);
-		return;
+void MMGMIDIPort::stopGenerator()
+{
+	if (!generator) return;
+
+	uint64_t sent = generator->sent();
+	generator.reset();
+	blog(LOG_INFO, QString("Loopback generator stopped (%1 messages sent, %2 captured).")
+			       .arg(sent)
+			       .arg(loopback_captured.load()));
+}
+
+bool MMGMIDIPort::startTrace(const QString &path)
+{
+	stopTrace();
+
+	std::unique_ptr<MMGMIDITrace::Writer> writer(new MMGMIDITrace::Writer(path, objectName()));
+	if (!writer->isOpen()) {
+		blog(LOG_INFO, QString("Cannot capture trace: <%1> could not be opened.").arg(path));
+		return false;
+	}
+
+	std::scoped_lock lock(trace_mutex);
+	trace_writer = std::move(writer);
+	tracing = true;
+
+	blog(LOG_INFO, QString("Capturing trace to <%1>...").arg(path));
+	return true;
+}
+
+void MMGMIDIPort::stopTrace()
+{
+	if (!tracing) return;
+	tracing = false;
+
+	std::scoped_lock lock(trace_mutex);
+	blog(LOG_INFO, QString("Trace captured (%1 messages).").arg(trace_writer->size()));
+	trace_writer.reset();
+}
+
+bool MMGMIDIPort::replayTrace(const QString &path, double speed)
+{
+	stopReplay();
+
+	auto sink = [this](const MMGMessageData &incoming) { return callback(incoming); };
+	auto done = [this](const MMGMIDITrace::Report &report) {
+		blog(LOG_INFO, "Trace replayed: " + report.summary());
 	};
 
-	for (auto *rec : recs)
-		rec->processMessage(incoming);
+	std::unique_ptr<MMGMIDITrace::Replayer> new_replayer(new MMGMIDITrace::Replayer(path, speed, sink, done));
+	if (!new_replayer->isValid()) {
+		blog(LOG_INFO, QString("Cannot replay trace: <%1> is not a valid trace file.").arg(path));
+		return false;
+	}
+
+	blog(LOG_INFO, QString("Replaying trace of <%1> (%2 messages) at %3...")
+			       .arg(new_replayer->deviceName())
+			       .arg(new_replayer->size())
+			       .arg(speed > 0 ? QString("%1x").arg(speed) : QString("full speed")));
+	replayer = std::move(new_replayer);
+	return true;
+}
+
+void MMGMIDIPort::stopReplay()
+{
+	replayer.reset();
+}
+
+bool MMGMIDIPort::callback(const MMGMessageData &incoming)
+{
+	std::scoped_lock input_lock(input_mutex);
+
+	if (tracing) {
+		std::scoped_lock lock(trace_mutex);
+		if (!!trace_writer) trace_writer->write(incoming);
+	}
+
+	if (!incoming.isCV()) return false; // Only using Channel Voice Messages
+
+	// Controller pairs are dispatched once complete, but thru always gets the original messages.
+	// Pairs are assembled from MIDI 1.0 messages, so conversion waits until they are,
+	// and completed pairs stay MIDI 2.0 packets so that their 14-bit values survive in MIDI 1.0
+	MMGMessageData message = incoming;
+	bool complete = pairing.process(message);
+	if (message.type() == incoming.type()) message = message.toProtocol(messageMode());
+
+	if (MMGMessageReceiver *blocking = blocking_rec; !!blocking) {
+		if (complete) blocking->processMessage(message);
+		return true;
+	};
+
+	if (complete) {
+		std::shared_ptr<const MMGMIDIConditions::Table> table;
+		{
+			std::scoped_lock lock(conditions_mutex);
+			table = conditions;
+		}
+
+		MMGMIDIConditions::Matches matches;
+		if (!!table) table->match(message, matches);
+		for (auto *rec : matches)
+			rec->processMessage(message);
+	}
 
 	sendThru(incoming);
+	return !recs.isEmpty() || !!_thru;
 }
 // End MMGMIDIPort
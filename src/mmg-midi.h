@@ -20,9 +20,16 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 #define MMG_MIDI_H
 
 #include "messages/mmg-message-data.h"
+#include "mmg-midi-conditions.h"
+#include "mmg-midi-loopback.h"
+#include "mmg-midi-pairing.h"
+#include "mmg-midi-trace.h"
 
 #include <libremidi/libremidi.hpp>
 
+#include <atomic>
+#include <mutex>
+
 static void inputAdded(const libremidi::input_port &port);
 static void inputRemoved(const libremidi::input_port &port);
 static void outputAdded(const libremidi::output_port &port);
@@ -34,15 +41,32 @@ class MMGMIDIPort : public QObject {
 public:
 	MMGMIDIPort *thru() const { return _thru; };
 	void setThru(MMGMIDIPort *device);
+	bool pairsControllers() const { return pair_controllers; };
+	void setPairControllers(bool pair);
 
 	bool isPortOpen(DeviceType type) const;
 	bool isCapable(DeviceType type) const;
 	QString status(DeviceType type) const;
+	MMGMessages::Type protocol() const { return _protocol; };
 
 	void blockReceiver(MMGMessageReceiver *rec, bool block) { blocking_rec = block ? rec : nullptr; };
 	void connectReceiver(MMGMessageReceiver *rec, bool connect);
+	void editReceiver(MMGMessageReceiver *rec, bool edit);
+	bool acceptsStatus(uint8_t status) const;
 	uint8_t receiverCount() const { return recs.size(); };
 
+	bool isLoopback() const { return loopback; };
+	void startGenerator(const MMGMIDILoopback::Settings &settings);
+	void stopGenerator();
+	uint64_t capturedCount() const { return loopback_captured; };
+
+	bool isTracing() const { return tracing; };
+	bool startTrace(const QString &path);
+	void stopTrace();
+	bool isReplaying() const { return !!replayer && replayer->isRunning(); };
+	bool replayTrace(const QString &path, double speed = 1.0);
+	void stopReplay();
+
 protected:
 	MMGMIDIPort(QObject *parent, const QJsonObject &json_obj);
 
@@ -57,10 +81,15 @@ public slots:
 
 protected:
 	QList<MMGMessageReceiver *> recs;
-	MMGMessageReceiver *blocking_rec = nullptr;
+	std::atomic<MMGMessageReceiver *> blocking_rec = nullptr;
 
 	MMGMIDIPort *_thru = nullptr;
 
+	bool pair_controllers = false;
+
+	bool loopback = false;
+	MMGMIDILoopback::Settings generator_settings;
+
 private:
 	std::unique_ptr<libremidi::input_port> in_port_info;
 	std::unique_ptr<libremidi::midi_in> midi_in;
@@ -68,9 +97,35 @@ private:
 	std::unique_ptr<libremidi::output_port> out_port_info;
 	std::unique_ptr<libremidi::midi_out> midi_out;
 
-	void callback(const MMGMessageData &incoming);
+	std::unique_ptr<MMGMIDITrace::Writer> trace_writer;
+	std::atomic_bool tracing = false;
+	std::mutex trace_mutex;
+
+	MMGMessages::Type _protocol = MMGMessages::MIDI1_CV;
+	MMGMIDIPairing::Pairer pairing;
+	std::atomic_uint16_t status_filter = 0;
+
+	// Receivers being edited may change at any time, so they are always tested
+	MMGMessageReceiver *edited_rec = nullptr;
+	std::shared_ptr<const MMGMIDIConditions::Table> conditions;
+	std::mutex conditions_mutex;
+
+	uint8_t loopback_open = 0;
+	mutable std::atomic_uint64_t loopback_captured = 0;
+
+	// Live input, the generator and replays all arrive through the callback, one message at a time
+	std::mutex input_mutex;
+
+	// Only called with the input mutex held
+	void refreshPairing();
+	void rebuildConditions();
+	bool callback(const MMGMessageData &incoming);
 	void sendThru(const MMGMessageData &incoming);
 
+	// Declared last so that they stop before anything they call into is destroyed
+	std::unique_ptr<MMGMIDILoopback::Generator> generator;
+	std::unique_ptr<MMGMIDITrace::Replayer> replayer;
+
 	friend void inputAdded(const libremidi::input_port &port);
 	friend void inputRemoved(const libremidi::input_port &port);
 	friend void outputAdded(const libremidi::output_port &port);
@@ -79,5 +134,6 @@ private:
 };
 
 void resetMIDIAPI(libremidi_api api);
+MMGMIDIPort *addLoopbackDevice(MMGMIDILoopback::Pattern pattern);
 
 #endif // MMG_MIDI_H
@@ -0,0 +1,190 @@
+/*
+obs-midi-mg
+Copyright (C) 2022-2026 nhielost <nhielost@gmail.com>
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program. If not, see <https://www.gnu.org/licenses/>
+*/
+
+#include "mmg-obs-catalog.h"
+
+#include <QHash>
+
+#include <atomic>
+#include <mutex>
+
+namespace MMGOBSCatalog {
+
+struct Entry {
+	uint64_t generation;
+	MMGStringTranslationMap list;
+};
+
+// Signals may come from any thread, so they only ever bump a generation.
+// Lists are built outside of the lock, so nothing here is held while libobs is
+static std::atomic_uint64_t generations[KIND_COUNT] {};
+static QHash<QByteArray, Entry> entries[KIND_COUNT];
+static std::mutex entries_mutex;
+static std::atomic_bool active = false;
+
+static void invalidate(std::initializer_list<Kind> kinds)
+{
+	for (Kind kind : kinds)
+		++generations[kind];
+}
+
+static void sourcesChanged(void *, calldata_t *)
+{
+	// Names, flags, filters, scene items and hotkey groups all follow their sources
+	invalidate({SCENES, SCENE_ITEMS, SOURCES, SOURCES_WITH_FILTERS, FILTERS, HOTKEYS, HOTKEY_CATEGORIES});
+}
+
+static void filtersChanged(void *, calldata_t *)
+{
+	invalidate({SOURCES_WITH_FILTERS, FILTERS});
+}
+
+static void sceneItemsChanged(void *, calldata_t *)
+{
+	invalidate({SCENE_ITEMS});
+}
+
+static void hotkeysChanged(void *, calldata_t *)
+{
+	invalidate({HOTKEYS, HOTKEY_CATEGORIES});
+}
+
+// Filter order and scene items are only signalled by their own source
+static void connectSource(obs_source_t *obs_source, bool connect)
+{
+	if (!obs_source) return;
+
+	auto change = connect ? signal_handler_connect : signal_handler_disconnect;
+	signal_handler_t *sh = obs_source_get_signal_handler(obs_source);
+
+	change(sh, "reorder_filters", filtersChanged, nullptr);
+	if (obs_source_get_type(obs_source) != OBS_SOURCE_TYPE_SCENE) return;
+
+	for (const char *signal : {"item_add", "item_remove", "reorder", "refresh"})
+		change(sh, signal, sceneItemsChanged, nullptr);
+}
+
+static void sourceDestroyed(void *, calldata_t *cd)
+{
+	sourcesChanged(nullptr, cd);
+
+	// Lists of a destroyed scene's items could never be looked up again
+	auto *obs_source = static_cast<obs_source_t *>(calldata_ptr(cd, "source"));
+	if (!obs_source || obs_source_get_type(obs_source) != OBS_SOURCE_TYPE_SCENE) return;
+
+	std::scoped_lock lock(entries_mutex);
+	entries[SCENE_ITEMS].remove(obs_source_get_uuid(obs_source));
+}
+
+static void connectAllSources(bool connect)
+{
+	obs_enum_all_sources(
+		[](void *param, obs_source_t *obs_source) {
+			connectSource(obs_source, *static_cast<bool *>(param));
+			return true;
+		},
+		&connect);
+}
+
+static void sourceCreated(void *, calldata_t *cd)
+{
+	connectSource(static_cast<obs_source_t *>(calldata_ptr(cd, "source")), true);
+	sourcesChanged(nullptr, cd);
+}
+
+static void frontendCallback(obs_frontend_event event, void *)
+{
+	switch (event) {
+		case OBS_FRONTEND_EVENT_SCENE_LIST_CHANGED:
+		case OBS_FRONTEND_EVENT_SCENE_COLLECTION_CHANGED:
+			invalidate({SCENES});
+			break;
+
+		case OBS_FRONTEND_EVENT_EXIT:
+			release();
+			break;
+
+		default:
+			break;
+	}
+}
+
+static void connectGlobalSignals(bool connect)
+{
+	auto change = connect ? signal_handler_connect : signal_handler_disconnect;
+	signal_handler_t *sh = obs_get_signal_handler();
+
+	change(sh, "source_create", sourceCreated, nullptr);
+	change(sh, "source_destroy", sourceDestroyed, nullptr);
+	for (const char *signal : {"source_remove", "source_rename"})
+		change(sh, signal, sourcesChanged, nullptr);
+	for (const char *signal : {"source_filter_add", "source_filter_remove"})
+		change(sh, signal, filtersChanged, nullptr);
+	for (const char *signal : {"hotkey_register", "hotkey_unregister"})
+		change(sh, signal, hotkeysChanged, nullptr);
+}
+
+void init()
+{
+	if (active) return;
+
+	connectGlobalSignals(true);
+	connectAllSources(true);
+	obs_frontend_add_event_callback(frontendCallback, nullptr);
+
+	active = true;
+}
+
+void release()
+{
+	if (!active) return;
+	active = false;
+
+	obs_frontend_remove_event_callback(frontendCallback, nullptr);
+	connectAllSources(false);
+	connectGlobalSignals(false);
+
+	std::scoped_lock lock(entries_mutex);
+	for (QHash<QByteArray, Entry> &kind_entries : entries)
+		kind_entries.clear();
+}
+
+const MMGStringTranslationMap lookup(Kind kind, const QByteArray &key,
+				     const std::function<MMGStringTranslationMap()> &build)
+{
+	// Nothing would tell the catalog about changes
+	if (!active) return build();
+
+	uint64_t generation = generations[kind];
+	{
+		std::scoped_lock lock(entries_mutex);
+		auto entry = entries[kind].constFind(key);
+		if (entry != entries[kind].constEnd() && entry->generation == generation) return entry->list;
+	}
+
+	// Anything that changes while building bumps the generation again, so lists already out of date are not kept
+	MMGStringTranslationMap list = build();
+
+	std::scoped_lock lock(entries_mutex);
+	if (generation != generations[kind]) return list;
+	if (!entries[kind].contains(key) || entries[kind].value(key).generation < generation)
+		entries[kind].insert(key, {generation, list});
+	return list;
+}
+
+} // namespace MMGOBSCatalog
@@ -0,0 +1,50 @@
+/*
+obs-midi-mg
+Copyright (C) 2022-2026 nhielost <nhielost@gmail.com>
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program. If not, see <https://www.gnu.org/licenses/>
+*/
+
+#ifndef MMG_OBS_CATALOG_H
+#define MMG_OBS_CATALOG_H
+
+#include "mmg-string.h"
+
+#include <functional>
+
+// Lists of OBS objects shared by every action display.
+// A list is built on first use, and kept until libobs signals that something in it may have changed
+namespace MMGOBSCatalog {
+
+enum Kind : uint8_t {
+	SCENES,
+	SCENE_ITEMS,
+	SOURCES,
+	SOURCES_WITH_FILTERS,
+	FILTERS,
+	HOTKEYS,
+	HOTKEY_CATEGORIES,
+	KIND_COUNT,
+};
+
+void init();
+void release();
+
+// The key tells lists of the same kind apart (e.g. the scene whose items are listed)
+const MMGStringTranslationMap lookup(Kind kind, const QByteArray &key,
+				     const std::function<MMGStringTranslationMap()> &build);
+
+} // namespace MMGOBSCatalog
+
+#endif // MMG_OBS_CATALOG_H
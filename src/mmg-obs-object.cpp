@@ -204,13 +204,7 @@ template <> MMGParams<QFont> MMGOBSField<QFont>::widgetParams() const
 // MMGOBSGroupField
 MMGOBSGroupField::MMGOBSGroupField(MMGOBSPropertyManager *parent, obs_property_t *prop) : MMGOBSProperty(parent, prop)
 {
-	group_props = new MMGOBSPropertyManager(qobject_cast<MMGOBSObject *>(parent->parent()),
-						obs_property_group_content(prop));
-}
-
-MMGOBSGroupField::~MMGOBSGroupField()
-{
-	group_props->deleteLater();
+	group_props = new MMGOBSPropertyManager(this, parent->object(), obs_property_group_content(prop));
 }
 
 void MMGOBSGroupField::loadProperty(const QJsonObject &json_obj)
@@ -319,10 +313,108 @@ template <> MMGParams<QString> MMGOBSField<QString>::widgetParams() const
 }
 // End QString
 
-// MMGOBSPropertyManager
-MMGOBSPropertyManager::MMGOBSPropertyManager(MMGOBSObject *parent, obs_properties_t *props) : QObject(parent)
+// MMGOBSPropertyCache
+struct MMGOBSCachedProperties {
+	// Null for types whose trees depend on their settings
+	obs_properties_t *props;
+	int32_t refs;
+};
+
+static std::mutex property_cache_mutex;
+static QHash<QString, MMGOBSCachedProperties> property_cache;
+
+// Properties that rebuild the tree when modified would carry one source's lists and visibility to another
+static bool settingsDependent(obs_properties_t *props, obs_data_t *settings)
 {
 	obs_property_t *prop = obs_properties_first(props);
+	if (!prop) return false;
+
+	do {
+		if (obs_property_modified(prop, settings)) return true;
+		if (obs_property_get_type(prop) == OBS_PROPERTY_GROUP &&
+		    settingsDependent(obs_property_group_content(prop), settings))
+			return true;
+	} while (obs_property_next(&prop) != 0);
+
+	return false;
+}
+
+static obs_properties_t *acquireProperties(const QString &type_id, obs_source_t *obs_source, bool &exclusive)
+{
+	std::lock_guard cache_guard(property_cache_mutex);
+
+	if (!exclusive) {
+		auto it = property_cache.find(type_id);
+		if (it == property_cache.end()) {
+			// Shared trees are built from the type alone, so they never refer to any one source
+			obs_properties_t *props = obs_get_source_properties(qUtf8Printable(type_id));
+			OBSDataAutoRelease defaults = obs_get_source_defaults(qUtf8Printable(type_id));
+			if (!!props && settingsDependent(props, defaults)) {
+				obs_properties_destroy(props);
+				props = nullptr;
+			}
+			it = property_cache.insert(type_id, {props, 0});
+		}
+
+		if (!!it->props) {
+			++it->refs;
+			return it->props;
+		}
+		exclusive = true;
+	}
+
+	return obs_source_properties(obs_source);
+}
+
+static void releaseProperties(const QString &type_id, obs_properties_t *props, bool exclusive)
+{
+	if (exclusive) {
+		obs_properties_destroy(props);
+		return;
+	}
+
+	std::lock_guard cache_guard(property_cache_mutex);
+
+	auto it = property_cache.find(type_id);
+	if (it == property_cache.end() || --it->refs > 0) return;
+
+	obs_properties_destroy(props);
+	property_cache.erase(it);
+}
+// End MMGOBSPropertyCache
+
+// MMGOBSPropertyManager
+MMGOBSPropertyManager::MMGOBSPropertyManager(QObject *parent, MMGOBSObject *object, obs_source_t *obs_source,
+					     bool exclusive)
+	: QObject(parent),
+	  _object(object),
+	  _type_id(obs_source_get_id(obs_source)),
+	  _owner(true),
+	  _exclusive(exclusive)
+{
+	// Types that cannot share a tree are given an exclusive one
+	_properties = acquireProperties(_type_id, obs_source, _exclusive);
+	createProperties();
+}
+
+MMGOBSPropertyManager::MMGOBSPropertyManager(QObject *parent, MMGOBSObject *object, obs_properties_t *props)
+	: QObject(parent),
+	  _object(object),
+	  _properties(props)
+{
+	createProperties();
+}
+
+MMGOBSPropertyManager::~MMGOBSPropertyManager()
+{
+	// Fields refer to the properties, so they are removed before the properties are released
+	qDeleteAll(_props);
+	if (_owner) releaseProperties(_type_id, _properties, _exclusive);
+}
+
+void MMGOBSPropertyManager::createProperties()
+{
+	obs_property_t *prop = obs_properties_first(_properties);
 
 	do {
 		MMGOBSProperty *new_prop;
@@ -381,7 +473,7 @@ MMGOBSPropertyManager::MMGOBSPropertyManager(MMGOBSObject *parent, obs_propertie
 
 const char *MMGOBSPropertyManager::sourceId() const
 {
-	return qobject_cast<MMGOBSObject *>(parent())->sourceId();
+	return _object->sourceId();
 }
 
 void MMGOBSPropertyManager::loadProperties(const QJsonObject &current_json, const QJsonObject &default_json) const
@@ -405,44 +497,66 @@ void MMGOBSObject::changeSource(const MMGString &source_id, const QJsonObject &j
 {
 	if (source_id == source_uuid) return;
 
-	if (!!props_manager) {
+	{
+		std::lock_guard custom_guard(custom_update);
+
 		delete props_manager;
 		props_manager = nullptr;
-	}
 
-	source_uuid = source_id;
-	property_json = {};
-	if (config()->fileVersion() < MMGConfig::VERSION_3_0) {
-		if (json_obj["json"].isString()) {
-			property_json = MMGJson::toObject(json_obj["json"].toString().toUtf8());
-		} else if (json_obj["json_str"].isString()) {
-			property_json = MMGJson::toObject(json_obj["json_str"].toString().toUtf8());
-		} else if (json_obj["str4"].isString()) {
-			property_json = MMGJson::toObject(json_obj["str4"].toString().toUtf8());
+		source_uuid = source_id;
+		property_json = {};
+		pending_data = {};
+		if (config()->fileVersion() < MMGConfig::VERSION_3_0) {
+			if (json_obj["json"].isString()) {
+				pending_data = MMGJson::toObject(json_obj["json"].toString().toUtf8());
+			} else if (json_obj["json_str"].isString()) {
+				pending_data = MMGJson::toObject(json_obj["json_str"].toString().toUtf8());
+			} else if (json_obj["str4"].isString()) {
+				pending_data = MMGJson::toObject(json_obj["str4"].toString().toUtf8());
+			}
+		} else {
+			pending_data = json_obj["json"].toObject();
 		}
-	} else {
-		property_json = json_obj["json"].toObject();
 	}
 
+	if (!OBSSourceAutoRelease(obs_get_source_by_uuid(source_uuid))) return;
+
+	if (!!created_display) {
+		created_display->removeExcept(front_widgets_num);
+		createDisplay(created_display);
+	}
+	emit sourceChanged();
+}
+
+bool MMGOBSObject::loadManager(bool exclusive) const
+{
+	if (!!props_manager && (!exclusive || props_manager->exclusive())) return true;
+
 	OBSSourceAutoRelease obs_source = obs_get_source_by_uuid(source_uuid);
-	if (!obs_source) return;
+	if (!obs_source) return false;
 
-	if (!!props) obs_properties_destroy(props);
-	props = obs_source_properties(obs_source);
-	props_manager = new MMGOBSPropertyManager(this, props);
-	connect(props_manager, &MMGOBSPropertyManager::propertyChanged, this, &MMGOBSObject::updateProperties);
+	QJsonObject data = pending_data;
+	if (!!props_manager) {
+		props_manager->jsonData(data);
+		delete props_manager;
+	}
+
+	// The manager may be built from an action thread, so it is handed to this object's thread
+	auto self = const_cast<MMGOBSObject *>(this);
+	props_manager = new MMGOBSPropertyManager(nullptr, self, obs_source, exclusive);
+	if (props_manager->thread() != thread()) props_manager->moveToThread(thread());
+	props_manager->setParent(self);
+	connect(props_manager, &MMGOBSPropertyManager::propertyChanged, self, &MMGOBSObject::updateProperties);
 
 	loadProperties();
+	property_json = data;
 	if (!property_json.isEmpty()) {
 		props_manager->loadData(property_json);
 		props_manager->jsonProperties(property_json);
 	}
+	pending_data = {};
 
-	if (!!created_display) {
-		created_display->removeExcept(front_widgets_num);
-		createDisplay(created_display);
-	}
-	emit sourceChanged();
+	return true;
 }
 
 QJsonObject MMGOBSObject::getSourceSettings(bool defaults) const
@@ -454,7 +568,7 @@ QJsonObject MMGOBSObject::getSourceSettings(bool defaults) const
 	return MMGJson::toObject(obs_data_get_json(obs_source_data));
 }
 
-void MMGOBSObject::loadProperties()
+void MMGOBSObject::loadProperties() const
 {
 	if (props_manager->size() == 0) return;
 	props_manager->loadProperties(getSourceSettings(), getSourceSettings(true));
@@ -464,7 +578,7 @@ void MMGOBSObject::updateProperties()
 {
 	props_manager->jsonProperties(property_json);
 	OBSDataAutoRelease obs_data = obs_data_create_from_json(MMGJson::toString(property_json));
-	obs_properties_apply_settings(props, obs_data);
+	obs_properties_apply_settings(props_manager->properties(), obs_data);
 	obs_source_update_properties(OBSSourceAutoRelease(obs_get_source_by_uuid(source_uuid)));
 
 	emit propertyChanged();
@@ -472,7 +586,9 @@ void MMGOBSObject::updateProperties()
 
 void MMGOBSObject::json(QJsonObject &json_obj) const
 {
-	QJsonObject save_obj;
+	std::lock_guard custom_guard(custom_update);
+
+	QJsonObject save_obj = pending_data;
 	if (!!props_manager) props_manager->jsonData(save_obj);
 	json_obj["json"] = save_obj;
 }
@@ -480,20 +596,28 @@ void MMGOBSObject::json(QJsonObject &json_obj) const
 void MMGOBSObject::copy(MMGOBSObject *dest) const
 {
 	QJsonObject this_json;
-	if (!!props_manager) props_manager->jsonData(this_json);
+	json(this_json);
 	dest->changeSource(source_uuid, this_json);
 }
 
 void MMGOBSObject::createDisplay(MMGWidgets::MMGActionDisplay *display)
 {
 	front_widgets_num = display->scrollCount();
-	props_manager->createDisplays(display);
 	created_display = display;
+
+	// Displays apply settings to their properties, so they cannot use a shared tree
+	std::unique_lock custom_guard(custom_update);
+	if (!loadManager(true)) return;
+	custom_guard.unlock();
+
+	props_manager->createDisplays(display);
 }
 
 void MMGOBSObject::execute(const MMGMappingTest &test) const
 {
 	std::lock_guard custom_guard(custom_update);
+	if (!loadManager()) return;
+
 	QJsonObject final_json = getSourceSettings();
 
 	props_manager->execute(test, final_json);
@@ -506,6 +630,8 @@ void MMGOBSObject::execute(const MMGMappingTest &test) const
 void MMGOBSObject::processEvent(MMGMappingTest &test) const
 {
 	std::lock_guard custom_guard(custom_update);
+	if (!loadManager()) return;
+
 	props_manager->processEvent(test, getSourceSettings());
 }
 // End MMGOBSObject
@@ -134,7 +134,6 @@ class MMGOBSGroupField : public MMGOBSProperty {
 
 public:
 	MMGOBSGroupField(MMGOBSPropertyManager *parent, obs_property_t *prop);
-	~MMGOBSGroupField();
 
 	void loadProperty(const QJsonObject &json_obj) override;
 	void loadData(const QJsonObject &json_obj) override;
@@ -163,8 +162,13 @@ class MMGOBSPropertyManager : public QObject {
 	Q_OBJECT
 
 public:
-	MMGOBSPropertyManager(MMGOBSObject *parent, obs_properties_t *props);
+	MMGOBSPropertyManager(QObject *parent, MMGOBSObject *object, obs_source_t *obs_source, bool exclusive);
+	MMGOBSPropertyManager(QObject *parent, MMGOBSObject *object, obs_properties_t *props);
+	~MMGOBSPropertyManager();
 
+	MMGOBSObject *object() const { return _object; };
+	obs_properties_t *properties() const { return _properties; };
+	bool exclusive() const { return _exclusive; };
 	const char *sourceId() const;
 	qsizetype size() const { return _props.size(); };
 
@@ -186,6 +190,15 @@ signals:
 	void propertyChanged();
 
 private:
+	void createProperties();
+
+private:
+	MMGOBSObject *_object;
+	QString _type_id;
+	obs_properties_t *_properties;
+	bool _owner = false;
+	bool _exclusive = false;
+
 	QList<MMGOBSProperty *> _props;
 };
 
@@ -194,10 +207,6 @@ class MMGOBSObject : public QObject {
 
 public:
 	MMGOBSObject(QObject *parent, const MMGString &source_id, const QJsonObject &json_obj);
-	~MMGOBSObject()
-	{
-		if (!!props) obs_properties_destroy(props);
-	};
 
 	const char *sourceId() const { return source_uuid; };
 	void changeSource(const MMGString &source_id, const QJsonObject &json_obj = {});
@@ -213,7 +222,8 @@ public:
 
 private:
 	void init() { changeSource(source_uuid, property_json); };
-	void loadProperties();
+	bool loadManager(bool exclusive = false) const;
+	void loadProperties() const;
 
 signals:
 	void sourceChanged();
@@ -225,9 +235,9 @@ private slots:
 private:
 	MMGString source_uuid;
 
-	obs_properties_t *props = nullptr;
-	MMGOBSPropertyManager *props_manager = nullptr;
+	mutable MMGOBSPropertyManager *props_manager = nullptr;
 	mutable QJsonObject property_json;
+	mutable QJsonObject pending_data;
 
 	MMGWidgets::MMGActionDisplay *created_display = nullptr;
 	int32_t front_widgets_num = 0;
@@ -21,6 +21,7 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 #include "mmg-midi.h"
 
 #include "ui/mmg-value-display.h"
+#include "ui/mmg-value-widget.h"
 
 #include <libremidi/api.hpp>
 #include <libremidi/libremidi.hpp>
@@ -34,6 +35,22 @@ namespace MMGPreferences {
 // MMGPreferenceGeneral
 MMGPreferenceGeneral *MMGPreferenceGeneral::self = nullptr;
 
+static MMGParams<bool> frame_sync_params {
+	.desc = mmgtr("Preferences.General.FrameSync"),
+	.options = OPTION_NONE,
+	.default_value = false,
+};
+
+void MMGPreferenceGeneral::load(const QJsonObject &json_obj)
+{
+	frame_sync = json_obj["frame_sync"].toBool();
+}
+
+void MMGPreferenceGeneral::json(QJsonObject &json_obj) const
+{
+	json_obj["frame_sync"] = frame_sync;
+}
+
 void MMGPreferenceGeneral::createDisplay(QWidget *widget)
 {
 	QHBoxLayout *main_layout = new QHBoxLayout;
@@ -78,6 +95,14 @@ void MMGPreferenceGeneral::createDisplay(QWidget *widget)
 	bug_report_button->setToolTip(mmgtr("Preferences.General.BugReport"));
 	connect(bug_report_button, &QPushButton::clicked, this, &MMGPreferenceGeneral::reportBug);
 	main_layout->addWidget(bug_report_button);
+
+	auto *frame_sync_display = new MMGWidgets::MMGValueFixedDisplay<bool>(widget, &frame_sync_params);
+	frame_sync_display->setContentsMargins(5, 5, 5, 5);
+	frame_sync_display->refresh();
+	frame_sync_display->setValue(frame_sync);
+	connect(frame_sync_display, &MMGWidgets::MMGValueQWidget::valueChanged, this,
+		[this, frame_sync_display]() { frame_sync = frame_sync_display->value(); });
+	widget->layout()->addWidget(frame_sync_display);
 }
 
 void MMGPreferenceGeneral::exportBindings() const
@@ -135,6 +160,23 @@ static MMGParams<MMGPreferenceMIDI::MessageMode> message_mode_params {
 		},
 };
 
+static MMGParams<MMGMIDIPort *> trace_device_params {
+	.desc = mmgtr("Preferences.MIDI.Trace.Device"),
+	.options = OPTION_NONE,
+	.default_value = nullptr,
+	.bounds = {},
+};
+
+static MMGParams<float> replay_speed_params {
+	.desc = mmgtr("Preferences.MIDI.Trace.Speed"),
+	.options = OPTION_NONE,
+	.default_value = 1.0f,
+	.lower_bound = 0.0,
+	.upper_bound = 16.0,
+	.step = 0.25,
+	.incremental_bound = 1.0,
+};
+
 void MMGPreferenceMIDI::load(const QJsonObject &json_obj)
 {
 	message_mode = MMGJson::getValue<MessageMode>(json_obj, "message_mode");
@@ -219,6 +261,85 @@ void MMGPreferenceMIDI::createDisplay(QWidget *widget)
 	connect(api_display, &MMGWidgets::MMGValueQWidget::valueChanged, this,
 		[this, api_display]() { setMIDIAPI(uint32_t(api_display->value())); });
 	widget->layout()->addWidget(api_display);
+
+	trace_device_params.bounds.clear();
+	trace_device_params.bounds.insert(nullptr, mmgtr("Plugin.Disabled"));
+	for (MMGDevice *device : *manager(device))
+		if (device->isCapable(TYPE_INPUT))
+			trace_device_params.bounds.insert(device, nontr(qUtf8Printable(device->objectName())));
+
+	auto *trace_device_display = new MMGWidgets::MMGValueFixedDisplay<MMGMIDIPort *>(widget, &trace_device_params);
+	trace_device_display->setContentsMargins(5, 5, 5, 5);
+	trace_device_display->refresh();
+	trace_device_display->setValue(trace_device);
+	widget->layout()->addWidget(trace_device_display);
+
+	auto *replay_speed_display = new MMGWidgets::MMGValueFixedDisplay<float>(widget, &replay_speed_params);
+	replay_speed_display->setContentsMargins(5, 5, 5, 5);
+	replay_speed_display->refresh();
+	replay_speed_display->setValue(replay_speed);
+	connect(replay_speed_display, &MMGWidgets::MMGValueQWidget::valueChanged, this,
+		[this, replay_speed_display]() { replay_speed = replay_speed_display->value(); });
+	widget->layout()->addWidget(replay_speed_display);
+
+	QHBoxLayout *trace_layout = new QHBoxLayout;
+	trace_layout->setContentsMargins(0, 0, 0, 0);
+	trace_layout->setSpacing(10);
+	qobject_cast<QVBoxLayout *>(widget->layout())->addLayout(trace_layout);
+
+	QPushButton *capture_button = new QPushButton(widget);
+	capture_button->setFixedHeight(40);
+	capture_button->setCursor(QCursor(Qt::PointingHandCursor));
+	connect(capture_button, &QPushButton::clicked, this,
+		[this, capture_button]() { captureTrace(capture_button); });
+	trace_layout->addWidget(capture_button, 1);
+
+	QPushButton *replay_button = new QPushButton(widget);
+	replay_button->setFixedHeight(40);
+	replay_button->setCursor(QCursor(Qt::PointingHandCursor));
+	replay_button->setText(mmgtr("Preferences.MIDI.Trace.Replay"));
+	connect(replay_button, &QPushButton::clicked, this, &MMGPreferenceMIDI::replayTrace);
+	trace_layout->addWidget(replay_button, 1);
+
+	auto refreshTraceButtons = [this, capture_button, replay_button]() {
+		capture_button->setEnabled(!!trace_device);
+		capture_button->setText(mmgtr(choosetr("Preferences.MIDI.Trace", "Stop", "Capture",
+						       !!trace_device && trace_device->isTracing())));
+		replay_button->setEnabled(!!trace_device);
+	};
+	connect(trace_device_display, &MMGWidgets::MMGValueQWidget::valueChanged, this,
+		[this, trace_device_display, refreshTraceButtons]() {
+			trace_device = trace_device_display->value();
+			refreshTraceButtons();
+		});
+	refreshTraceButtons();
+}
+
+void MMGPreferenceMIDI::captureTrace(QPushButton *capture_button)
+{
+	if (!trace_device) return;
+
+	if (trace_device->isTracing()) {
+		trace_device->stopTrace();
+	} else {
+		QString filepath = QFileDialog::getSaveFileName(nullptr, mmgtr("Preferences.MIDI.Trace.CaptureTitle"),
+								"", mmgtr("Preferences.MIDI.Trace.FileType"));
+		if (!filepath.isNull() && !trace_device->startTrace(filepath)) prompt_info("TraceError");
+	}
+
+	capture_button->setText(
+		mmgtr(choosetr("Preferences.MIDI.Trace", "Stop", "Capture", trace_device->isTracing())));
+}
+
+void MMGPreferenceMIDI::replayTrace()
+{
+	if (!trace_device) return;
+
+	QString filepath = QFileDialog::getOpenFileName(nullptr, mmgtr("Preferences.MIDI.Trace.ReplayTitle"), "",
+							mmgtr("Preferences.MIDI.Trace.FileType"));
+	if (filepath.isNull()) return;
+
+	if (!trace_device->replayTrace(filepath, replay_speed)) prompt_info("TraceError");
 }
 // End MMGPreferenceMIDI
 
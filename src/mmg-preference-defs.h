@@ -20,6 +20,10 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 
 #include "mmg-preference.h"
 
+#include <QPointer>
+
+class MMGMIDIPort;
+
 namespace MMGPreferences {
 
 class MMGPreferenceGeneral : public MMGPreference {
@@ -36,14 +40,22 @@ public:
 	static Id preferenceId() { return Id(0x0001); };
 	const char *trPreferenceName() const override { return "General"; };
 
+	void load(const QJsonObject &json_obj) override;
+	void json(QJsonObject &json_obj) const override;
+
 	void createDisplay(QWidget *widget) override;
 
+	static bool frameSyncTransforms() { return !!self && self->frame_sync; };
+
 private:
 	void exportBindings() const;
 	void importBindings() const;
 	void openHelp() const;
 	void reportBug() const;
 
+private:
+	bool frame_sync = false;
+
 	static MMGPreferenceGeneral *self;
 };
 MMG_DECLARE_PREFERENCE(MMGPreferenceGeneral);
@@ -81,10 +93,16 @@ private:
 	void initMIDI();
 	static void refreshAPIs();
 
+	void captureTrace(QPushButton *capture_button);
+	void replayTrace();
+
 private:
 	uint32_t midi_api = 0xffffffff;
 	MessageMode message_mode = MIDI_ALWAYS_1;
 
+	QPointer<MMGMIDIPort> trace_device;
+	float replay_speed = 1.0f;
+
 	static MMGPreferenceMIDI *self;
 };
 MMG_DECLARE_PREFERENCE(MMGPreferenceMIDI);
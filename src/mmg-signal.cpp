@@ -18,8 +18,12 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 
 #include "mmg-signal.h"
 #include "mmg-config.h"
+#include "mmg-obs-catalog.h"
 
 #include <QMessageBox>
+#include <QMutex>
+
+#include <atomic>
 
 namespace MMGSignal {
 
@@ -28,12 +32,26 @@ struct SourceIdentifier {
 	const char *signal_name;
 };
 
-static QList<MMGFrontendReceiver *> frontend_recs;
+static QMap<obs_frontend_event, QList<MMGFrontendReceiver *>> frontend_recs;
 static QMap<MMGSourceReceiver *, SourceIdentifier> source_recs;
-static QList<MMGHotkeyReceiver *> hotkey_recs;
 static bool signal_init = false;
 static bool allow_events = false;
 
+// Hotkey receivers by the hotkeys they watch, resolved from the names they were connected with.
+// This is only rebuilt when a hotkey is routed, so connecting a receiver never enumerates hotkeys
+struct HotkeyIndex {
+	QMap<MMGHotkeyReceiver *, QList<MMGString>> recs;
+	QHash<obs_hotkey_id, QList<MMGHotkeyReceiver *>> by_id;
+	QList<MMGHotkeyReceiver *> any;
+	QHash<obs_hotkey_id, MMGString> names;
+};
+
+static HotkeyIndex hotkey_index;
+static QMutex hotkey_mutex;
+static std::atomic_bool hotkeys_stale = true;
+
+void hotkeysChangedCallback(void *, calldata_t *);
+
 void frontendCallback(obs_frontend_event event, void *)
 {
 	switch (event) {
@@ -42,15 +60,26 @@ void frontendCallback(obs_frontend_event event, void *)
 			allow_events = true;
 			break;
 
-		case OBS_FRONTEND_EVENT_EXIT:
+		case OBS_FRONTEND_EVENT_EXIT: {
 			obs_frontend_remove_event_callback(frontendCallback, nullptr);
+
+			signal_handler_t *sh = obs_get_signal_handler();
+			signal_handler_disconnect(sh, "hotkey_register", hotkeysChangedCallback, nullptr);
+			signal_handler_disconnect(sh, "hotkey_unregister", hotkeysChangedCallback, nullptr);
 			break;
+		}
 
-		default:
+		default: {
 			if (!allow_events) break;
-			for (MMGFrontendReceiver *rec : frontend_recs)
-				rec->processEvent(event);
+
+			const QList<MMGFrontendReceiver *> recs = frontend_recs.value(event);
+			if (recs.isEmpty()) break;
+
+			MMGFrontendState state(event);
+			for (MMGFrontendReceiver *rec : recs)
+				rec->processEvent(state);
 			break;
+		}
 	}
 }
 
@@ -66,6 +95,33 @@ void destroyCallback(void *ptr, calldata_t *)
 	if (!!rec) source_recs.remove(rec);
 }
 
+static void rebuildHotkeyIndex()
+{
+	hotkey_index.by_id.clear();
+	hotkey_index.any.clear();
+	hotkey_index.names.clear();
+
+	QMultiHash<QByteArray, obs_hotkey_id> ids;
+	obs_enum_hotkeys(
+		[](void *param, obs_hotkey_id id, obs_hotkey_t *hotkey) {
+			const char *name = obs_hotkey_get_name(hotkey);
+			hotkey_index.names.insert(id, name);
+			reinterpret_cast<QMultiHash<QByteArray, obs_hotkey_id> *>(param)->insert(name, id);
+			return true;
+		},
+		&ids);
+
+	for (auto [rec, names] : hotkey_index.recs.asKeyValueRange()) {
+		if (names.isEmpty()) hotkey_index.any += rec;
+
+		// Hotkeys registered per source share their name, so one name can resolve to many hotkeys
+		for (const MMGString &name : names) {
+			for (obs_hotkey_id id : ids.values(name.value()))
+				hotkey_index.by_id[id] += rec;
+		}
+	}
+}
+
 void hotkeyCallback(void *, obs_hotkey_id id, bool pressed)
 {
 	QMetaObject::invokeMethod(static_cast<QObject *>(obs_frontend_get_main_window()), "ProcessHotkey",
@@ -73,8 +129,21 @@ void hotkeyCallback(void *, obs_hotkey_id id, bool pressed)
 
 	if (!pressed) return;
 
-	for (MMGHotkeyReceiver *rec : hotkey_recs)
-		rec->processEvent(id);
+	QMutexLocker locker(&hotkey_mutex);
+	if (hotkeys_stale.exchange(false)) rebuildHotkeyIndex();
+
+	auto name = hotkey_index.names.constFind(id);
+	if (name == hotkey_index.names.constEnd()) return;
+
+	for (MMGHotkeyReceiver *rec : hotkey_index.by_id.value(id))
+		rec->processEvent(id, *name);
+	for (MMGHotkeyReceiver *rec : hotkey_index.any)
+		rec->processEvent(id, *name);
+}
+
+void hotkeysChangedCallback(void *, calldata_t *)
+{
+	hotkeys_stale = true;
 }
 
 void disconnectSource(MMGSourceReceiver *rec)
@@ -109,11 +178,13 @@ void connectSource(MMGSourceReceiver *rec)
 
 void connectMMGSignal(MMGFrontendReceiver *rec, bool connect)
 {
-	if (connect) {
-		if (!frontend_recs.contains(rec)) frontend_recs += rec;
-	} else {
-		frontend_recs.removeOne(rec);
-	}
+	// Receivers are also disconnected from their destructor, so their events cannot be asked for here
+	for (QList<MMGFrontendReceiver *> &recs : frontend_recs)
+		recs.removeOne(rec);
+	if (!connect) return;
+
+	for (obs_frontend_event event : rec->frontendEvents())
+		frontend_recs[event] += rec;
 }
 
 void connectMMGSignal(MMGSourceReceiver *rec, bool connect)
@@ -127,13 +198,81 @@ void connectMMGSignal(MMGSourceReceiver *rec, bool connect)
 
 void connectMMGSignal(MMGHotkeyReceiver *rec, bool connect)
 {
+	// Receivers are also disconnected from their destructor, so their hotkeys cannot be asked for here
+	QMutexLocker locker(&hotkey_mutex);
+
 	if (connect) {
-		if (!hotkey_recs.contains(rec)) hotkey_recs += rec;
-	} else {
-		hotkey_recs.removeOne(rec);
+		hotkey_index.recs.insert(rec, rec->hotkeyNames());
+		hotkeys_stale = true;
+		return;
+	}
+
+	if (!hotkey_index.recs.remove(rec)) return;
+	for (QList<MMGHotkeyReceiver *> &recs : hotkey_index.by_id)
+		recs.removeOne(rec);
+	hotkey_index.any.removeOne(rec);
+}
+
+// MMGFrontendState
+const MMGString &MMGFrontendState::scene(bool preview) const
+{
+	std::optional<MMGString> &scene = preview ? preview_scene : current_scene;
+	if (!scene) {
+		OBSSourceAutoRelease obs_scene =
+			preview ? obs_frontend_get_current_preview_scene() : obs_frontend_get_current_scene();
+		scene = MMGString(obs_source_get_uuid(obs_scene));
+	}
+	return *scene;
+}
+
+const MMGString &MMGFrontendState::transition() const
+{
+	if (!current_transition) {
+		OBSSourceAutoRelease obs_transition = obs_frontend_get_current_transition();
+		current_transition = MMGString(obs_source_get_name(obs_transition));
 	}
+	return *current_transition;
+}
+
+int MMGFrontendState::transitionDuration() const
+{
+	if (!transition_duration) transition_duration = obs_frontend_get_transition_duration();
+	return *transition_duration;
+}
+
+int MMGFrontendState::tbarPosition() const
+{
+	if (!tbar_position) tbar_position = obs_frontend_get_tbar_position();
+	return *tbar_position;
 }
 
+const MMGString &MMGFrontendState::profile() const
+{
+	if (!current_profile) {
+		char *char_profile = obs_frontend_get_current_profile();
+		current_profile = MMGString(char_profile);
+		bfree(char_profile);
+	}
+	return *current_profile;
+}
+
+const MMGString &MMGFrontendState::collection() const
+{
+	if (!current_collection) {
+		char *char_collection = obs_frontend_get_current_scene_collection();
+		current_collection = MMGString(char_collection);
+		bfree(char_collection);
+	}
+	return *current_collection;
+}
+
+bool MMGFrontendState::studioMode() const
+{
+	if (!studio_mode) studio_mode = obs_frontend_preview_program_mode_active();
+	return *studio_mode;
+}
+// End MMGFrontendState
+
 void initSignals()
 {
 	if (signal_init) return;
@@ -142,6 +281,12 @@ void initSignals()
 	obs_frontend_add_event_callback(frontendCallback, nullptr);
 	obs_hotkey_enable_callback_rerouting(true);
 	obs_hotkey_set_callback_routing_func(hotkeyCallback, nullptr);
+
+	signal_handler_t *sh = obs_get_signal_handler();
+	signal_handler_connect(sh, "hotkey_register", hotkeysChangedCallback, nullptr);
+	signal_handler_connect(sh, "hotkey_unregister", hotkeysChangedCallback, nullptr);
+
+	MMGOBSCatalog::init();
 }
 
 } // namespace MMGSignal
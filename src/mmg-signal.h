@@ -21,6 +21,8 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 
 #include "mmg-string.h"
 
+#include <optional>
+
 namespace MMGSignal {
 
 void initSignals();
@@ -33,11 +35,41 @@ void connectMMGSignal(MMGFrontendReceiver *rec, bool connect);
 void connectMMGSignal(MMGSourceReceiver *rec, bool connect);
 void connectMMGSignal(MMGHotkeyReceiver *rec, bool connect);
 
+// Frontend state, read at most once per event and shared by every receiver of that event
+class MMGFrontendState {
+public:
+	MMGFrontendState(obs_frontend_event event) : _event(event) {};
+
+	obs_frontend_event event() const { return _event; };
+
+	const MMGString &scene(bool preview = false) const;
+	const MMGString &transition() const;
+	int transitionDuration() const;
+	int tbarPosition() const;
+	const MMGString &profile() const;
+	const MMGString &collection() const;
+	bool studioMode() const;
+
+private:
+	obs_frontend_event _event;
+
+	mutable std::optional<MMGString> current_scene;
+	mutable std::optional<MMGString> preview_scene;
+	mutable std::optional<MMGString> current_transition;
+	mutable std::optional<int> transition_duration;
+	mutable std::optional<int> tbar_position;
+	mutable std::optional<MMGString> current_profile;
+	mutable std::optional<MMGString> current_collection;
+	mutable std::optional<bool> studio_mode;
+};
+
 class MMGFrontendReceiver {
 public:
 	virtual ~MMGFrontendReceiver() { connectMMGSignal(this, false); };
 
-	virtual void processEvent(obs_frontend_event event) const = 0;
+	// Only these events are ever passed to processEvent
+	virtual QList<obs_frontend_event> frontendEvents() const = 0;
+	virtual void processEvent(const MMGFrontendState &state) const = 0;
 };
 
 class MMGSourceReceiver {
@@ -54,7 +86,9 @@ class MMGHotkeyReceiver {
 public:
 	virtual ~MMGHotkeyReceiver() { connectMMGSignal(this, false); };
 
-	virtual void processEvent(obs_hotkey_id id) const = 0;
+	// Names of the hotkeys to receive, or none to receive every hotkey
+	virtual QList<MMGString> hotkeyNames() const = 0;
+	virtual void processEvent(obs_hotkey_id id, const MMGString &name) const = 0;
 };
 
 } // namespace MMGSignal
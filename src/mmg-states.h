@@ -91,6 +91,7 @@ public:
 	virtual operator const T &() const { throw; };
 
 protected:
+	virtual MMGState<T> *clone() const = 0;
 	virtual void init(const QJsonObject &json_obj) = 0;
 	virtual void json(QJsonObject &json_obj) const = 0;
 
@@ -109,6 +110,7 @@ public:
 	void setValue(const T &value) { fixed_value = value; };
 
 protected:
+	MMGState<T> *clone() const override { return new Fixed<T>(*this); };
 	void init(const QJsonObject &json_obj) override;
 	void json(QJsonObject &json_obj) const override;
 
@@ -142,6 +144,7 @@ public:
 	int64_t referenceSize() const override { return mappings.size(); };
 
 protected:
+	MMGState<T> *clone() const override { return new MIDIMap<T>(*this); };
 	void init(const QJsonObject &json_obj) override;
 	void json(QJsonObject &json_obj) const override;
 
@@ -166,6 +169,7 @@ public:
 	int64_t referenceSize() const override { return std::abs(int64_t(max_value) - int64_t(min_value)) + 1; };
 
 protected:
+	MMGState<T> *clone() const override { return new MIDIRange<T>(*this); };
 	void init(const QJsonObject &json_obj) override;
 	void json(QJsonObject &json_obj) const override;
 
@@ -193,6 +197,7 @@ public:
 	void setCurrentIndex(int64_t current_index) { index = current_index; };
 
 protected:
+	MMGState<T> *clone() const override { return new Toggle<T>(*this); };
 	void init(const QJsonObject &json_obj) override;
 	void json(QJsonObject &json_obj) const override;
 
@@ -215,6 +220,7 @@ public:
 	void setIncrement(const T &increment) { _increment = increment; };
 
 protected:
+	MMGState<T> *clone() const override { return new Increment<T>(*this); };
 	void init(const QJsonObject &json_obj) override;
 	void json(QJsonObject &json_obj) const override;
 
@@ -232,6 +238,7 @@ public:
 	ValueState state() const override { return STATE_IGNORE; };
 
 protected:
+	MMGState<T> *clone() const override { return new Ignore<T>(*this); };
 	void init(const QJsonObject &) override {};
 	void json(QJsonObject &) const override {};
 
@@ -245,6 +252,7 @@ public:
 	ValueState state() const override { return STATE_TOGGLE; };
 
 protected:
+	MMGState<bool> *clone() const override { return new Toggle<bool>(*this); };
 	void init(const QJsonObject &) override {};
 	void json(QJsonObject &) const override {};
 
@@ -72,7 +72,6 @@ template <typename T> void MMGValue<T>::init(const QJsonObject &json_obj)
 
 template <typename T> void MMGValue<T>::copy(MMGValue<T> &other) const
 {
-	QJsonObject json_obj;
-	_data->json(json_obj, "copy");
-	other.init(json_obj["copy"].toObject());
+	if (&other == this) return;
+	other._data.reset(_data->clone());
 }
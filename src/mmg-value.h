@@ -28,6 +28,7 @@ public:
 
 	MMGValue();
 	MMGValue(const QJsonObject &json_obj, const QString &prefix);
+	MMGValue(MMGValue<T> &&other) = default;
 
 	const MMGStates::MMGState<T> *operator->() const { return _data.get(); };
 	MMGStates::MMGState<T> *operator->() { return _data.get(); };
@@ -19,6 +19,7 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 #include "obs-midi-mg.h"
 
 #include "mmg-config.h"
+#include "actions/mmg-action-scene-items.h"
 #include "ui/mmg-echo-window.h"
 
 #include <QAction>
@@ -94,6 +95,7 @@ bool obs_module_load(void)
 	bfree(config_path);
 
 	// Load the configuration
+	MMGEpoch::init();
 	global_config = new MMGConfig;
 	global_config->load();
 	QObject::connect(global_config, &MMGConfig::refreshRequested, showUI);
@@ -102,6 +104,8 @@ bool obs_module_load(void)
 	auto *menu_action = (QAction *)obs_frontend_add_tools_menu_qaction(mmgtr("Plugin.ToolsButton").translate());
 	QObject::connect(menu_action, &QAction::triggered, showUI);
 
+	MMGActions::MMGFrameTransforms::init();
+
 	// Done
 	mmgblog(LOG_INFO, "Plugin loaded.");
 	return true;
@@ -109,7 +113,9 @@ bool obs_module_load(void)
 
 void obs_module_unload()
 {
+	MMGActions::MMGFrameTransforms::release();
 	delete global_config;
+	MMGEpoch::release();
 	mmgblog(LOG_INFO, "Plugin unloaded.");
 }
 
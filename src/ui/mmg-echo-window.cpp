@@ -35,6 +35,12 @@ MMGParams<MMGMIDIPort *> MMGEchoWindow::thru_params {
 	.bounds = {},
 };
 
+MMGParams<bool> MMGEchoWindow::pair_params {
+	.desc = mmgtr("Device.PairControllers"),
+	.options = OPTION_NONE,
+	.default_value = false,
+};
+
 MMGParams<MMGBinding::ResetMode> MMGEchoWindow::reset_mode_params {
 	.desc = mmgtr("Binding.Label.ResetMode"),
 	.options = OPTION_NONE,
@@ -55,9 +61,34 @@ MMGEchoWindow::MMGEchoWindow(QWidget *parent) : QDialog(parent, Qt::Dialog), ui(
 	menu_binding_groups->setTitle(mmgtr("UI.Buttons.Move"));
 	menu_binding_groups->setIcon(mmgicon("move"));
 
+	menu_loopback_patterns = new QMenu(this);
+	for (auto [pattern, text] : {
+		     std::pair {MMGMIDILoopback::NONE, "Device.Loopback.Pattern.None"},
+		     std::pair {MMGMIDILoopback::CC_SWEEP, "Device.Loopback.Pattern.ControlSweep"},
+		     std::pair {MMGMIDILoopback::NOTE_STORM, "Device.Loopback.Pattern.NoteStorm"},
+		     std::pair {MMGMIDILoopback::PITCH_BEND, "Device.Loopback.Pattern.PitchBend"},
+	     }) {
+		QAction *new_action = new QAction(this);
+		new_action->setText(mmgtr(text));
+		new_action->setData(int(pattern));
+		connect(new_action, &QAction::triggered, this, &MMGEchoWindow::onDeviceLoopbackSelect);
+		menu_loopback_patterns->addAction(new_action);
+	}
+
+	button_add_loopback = new QPushButton(ui->editor_device_check);
+	button_add_loopback->setFixedSize(40, 40);
+	button_add_loopback->setCursor(QCursor(Qt::PointingHandCursor));
+	button_add_loopback->setFocusPolicy(Qt::ClickFocus);
+	button_add_loopback->setIcon(mmgicon("add"));
+	button_add_loopback->setIconSize(QSize(20, 20));
+	ui->layout_device_check->insertWidget(1, button_add_loopback);
+
 	thru_display = new MMGValueFixedDisplay<MMGMIDIPort *>(ui->editor_device, &thru_params);
 	thru_display->setGeometry(0, 100, 330, 40);
 
+	pair_display = new MMGValueFixedDisplay<bool>(ui->editor_device, &pair_params);
+	pair_display->setGeometry(0, 140, 330, 40);
+
 	reset_mode_display = new MMGValueFixedDisplay<MMGBinding::ResetMode>(this, &reset_mode_params);
 	reset_mode_display->setFixedHeight(40);
 	ui->layout_binding_info->insertWidget(3, reset_mode_display);
@@ -127,7 +158,9 @@ void MMGEchoWindow::connectUISignals()
 	connect(ui->button_out_enable, &QAbstractButton::toggled, this, &MMGEchoWindow::onDeviceOutputActiveChange);
 	connect(ui->button_device_refresh, &QPushButton::clicked, this, &MMGEchoWindow::onDeviceRefresh);
 	connect(ui->button_remove_device, &QPushButton::clicked, this, &MMGEchoWindow::onDeviceRemove);
+	connect(button_add_loopback, &QPushButton::clicked, this, &MMGEchoWindow::onDeviceLoopbackClick);
 	connect(thru_display, &MMGValueQWidget::valueChanged, this, &MMGEchoWindow::onDeviceThruChange);
+	connect(pair_display, &MMGValueQWidget::valueChanged, this, &MMGEchoWindow::onDevicePairChange);
 
 	// Multipurpose Display Connections
 	connect(ui->button_message_edit, &QPushButton::clicked, this, &MMGEchoWindow::onMessageEditClick);
@@ -170,6 +203,7 @@ void MMGEchoWindow::translate()
 
 	ui->button_confirm->setToolTip(mmgtr("UI.Buttons.Confirm"));
 	ui->button_device_refresh->setText(mmgtr("Device.Refresh"));
+	button_add_loopback->setToolTip(mmgtr("Device.Loopback.Add"));
 	ui->label_value_editor_info->setText(mmgtr("UI.Text.ValueEditorInfo"));
 
 	ui->label_binding_enable->setText(mmgtr("Binding.Label.Status"));
@@ -278,7 +312,8 @@ void MMGEchoWindow::deviceShow()
 {
 	current_device = device_display->currentValue();
 	ui->editor_device->setVisible(!!current_device);
-	ui->button_remove_device->setVisible(!!current_device && !current_device->isCapable(TYPE_NONE));
+	ui->button_remove_device->setVisible(!!current_device &&
+					     (!current_device->isCapable(TYPE_NONE) || current_device->isLoopback()));
 	if (!current_device) return;
 
 	current_device->setEditable(false);
@@ -312,6 +347,10 @@ void MMGEchoWindow::onDeviceInputActiveChange(bool toggled)
 	thru_params.options.setFlag(OPTION_DISABLED, !toggled);
 	thru_display->setValue(current_device->isActive(TYPE_INPUT) ? current_device->thru() : nullptr);
 	thru_display->refresh();
+
+	pair_params.options.setFlag(OPTION_DISABLED, !toggled);
+	pair_display->setValue(current_device->pairsControllers());
+	pair_display->refresh();
 }
 
 void MMGEchoWindow::onDeviceOutputActiveChange(bool toggled)
@@ -327,6 +366,11 @@ void MMGEchoWindow::onDeviceThruChange()
 	current_device->setThru(thru_display->value());
 }
 
+void MMGEchoWindow::onDevicePairChange()
+{
+	current_device->setPairControllers(pair_display->value());
+}
+
 void MMGEchoWindow::onDeviceRefresh()
 {
 	resetMIDIAPI(libremidi_api(MMGPreferences::MMGPreferenceMIDI::currentAPI()));
@@ -341,6 +385,24 @@ void MMGEchoWindow::onDeviceRemove()
 	deviceShow();
 }
 
+void MMGEchoWindow::onDeviceLoopbackClick()
+{
+	menu_loopback_patterns->popup(QCursor::pos());
+}
+
+void MMGEchoWindow::onDeviceLoopbackSelect()
+{
+	if (!sender()) return;
+
+	auto action = qobject_cast<QAction *>(sender());
+	if (!action) return;
+
+	auto *device = static_cast<MMGDevice *>(addLoopbackDevice(MMGMIDILoopback::Pattern(action->data().toInt())));
+	device_display->refresh();
+	if (!!device) device_display->setCurrentValue(device);
+	deviceShow();
+}
+
 void MMGEchoWindow::onMessageEditClick()
 {
 	changeView(MODE_MESSAGE);
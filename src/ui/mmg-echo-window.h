@@ -40,6 +40,8 @@ private:
 	Ui::MMGEchoWindow *ui;
 
 	QMenu *menu_binding_groups;
+	QMenu *menu_loopback_patterns;
+	QPushButton *button_add_loopback;
 
 	MMGWidgets::MMGMessageDisplay *message_object_display;
 	MMGWidgets::MMGActionDisplay *action_object_display;
@@ -54,6 +56,9 @@ private:
 	MMGWidgets::MMGValueFixedDisplay<MMGMIDIPort *> *thru_display;
 	static MMGParams<MMGMIDIPort *> thru_params;
 
+	MMGWidgets::MMGValueFixedDisplay<bool> *pair_display;
+	static MMGParams<bool> pair_params;
+
 	MMGWidgets::MMGValueFixedDisplay<MMGBinding::ResetMode> *reset_mode_display;
 	static MMGParams<MMGBinding::ResetMode> reset_mode_params;
 
@@ -89,8 +94,11 @@ private slots:
 	void onDeviceInputActiveChange(bool toggled);
 	void onDeviceOutputActiveChange(bool toggled);
 	void onDeviceThruChange();
+	void onDevicePairChange();
 	void onDeviceRefresh();
 	void onDeviceRemove();
+	void onDeviceLoopbackClick();
+	void onDeviceLoopbackSelect();
 
 	void onMessageEditClick();
 	void onActionEditClick();
@@ -18,8 +18,167 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 
 #include "mmg-manager-display.h"
 
+#include <QMimeData>
+
 namespace MMGWidgets {
 
+static const char *row_mime_type = "application/x-obs-midi-mg-row";
+
+// MMGManagerListModel
+int MMGManagerListModel::rowCount(const QModelIndex &parent) const
+{
+	if (parent.isValid()) return 0;
+	return _filter.isEmpty() ? valueCount() : filtered_rows.size();
+}
+
+QVariant MMGManagerListModel::data(const QModelIndex &index, int role) const
+{
+	if (!index.isValid() || (role != Qt::DisplayRole && role != Qt::EditRole)) return QVariant();
+
+	QObject *index_value = valueAt(index.row());
+	return !!index_value ? index_value->objectName() : QVariant();
+}
+
+bool MMGManagerListModel::setData(const QModelIndex &index, const QVariant &new_value, int role)
+{
+	if (!index.isValid() || role != Qt::EditRole) return false;
+
+	QObject *index_value = valueAt(index.row());
+	if (!index_value) return false;
+
+	index_value->setObjectName(new_value.toString());
+	emit dataChanged(index, index, {Qt::DisplayRole, Qt::EditRole});
+	emit valueRenamed(new_value.toString());
+	return true;
+}
+
+Qt::ItemFlags MMGManagerListModel::flags(const QModelIndex &index) const
+{
+	// Rows can only be moved while every row is shown
+	bool movable = _editable && _filter.isEmpty();
+	if (!index.isValid()) return movable ? Qt::ItemIsDropEnabled : Qt::NoItemFlags;
+
+	Qt::ItemFlags item_flags = Qt::ItemIsSelectable | Qt::ItemIsEnabled;
+	if (_editable) item_flags |= Qt::ItemIsEditable;
+	if (movable) item_flags |= Qt::ItemIsDragEnabled;
+	return item_flags;
+}
+
+QStringList MMGManagerListModel::mimeTypes() const
+{
+	return {row_mime_type};
+}
+
+QMimeData *MMGManagerListModel::mimeData(const QModelIndexList &indexes) const
+{
+	if (indexes.isEmpty()) return nullptr;
+
+	QMimeData *mime_data = new QMimeData;
+	mime_data->setData(row_mime_type, QByteArray::number(indexes.first().row()));
+	return mime_data;
+}
+
+bool MMGManagerListModel::dropMimeData(const QMimeData *data, Qt::DropAction action, int row, int,
+				       const QModelIndex &parent)
+{
+	if (action != Qt::MoveAction || !data->hasFormat(row_mime_type) || !_filter.isEmpty()) return false;
+
+	if (parent.isValid()) row = parent.row();
+	if (row < 0 || row > valueCount()) row = valueCount();
+
+	// After a successful drop, the view removes the dragged row through removeRows,
+	// which this model leaves unimplemented (so the moved value is kept)
+	return moveRows(QModelIndex(), data->data(row_mime_type).toInt(), 1, QModelIndex(), row);
+}
+
+bool MMGManagerListModel::moveRows(const QModelIndex &source_parent, int source_row, int count,
+				   const QModelIndex &dest_parent, int dest_row)
+{
+	// Internal moves in a QListView come through here first, and only fall back to dropMimeData if refused
+	if (source_parent.isValid() || dest_parent.isValid() || count != 1 || !_editable || !_filter.isEmpty())
+		return false;
+	if (source_row < 0 || source_row >= valueCount() || dest_row < 0 || dest_row > valueCount()) return false;
+	if (!beginMoveRows(QModelIndex(), source_row, source_row, QModelIndex(), dest_row)) return false;
+
+	moveValue(source_row, dest_row > source_row ? dest_row - 1 : dest_row);
+	endMoveRows();
+	return true;
+}
+
+QObject *MMGManagerListModel::valueAt(int row) const
+{
+	if (row < 0 || row >= rowCount()) return nullptr;
+	return value(_filter.isEmpty() ? row : filtered_rows[row]);
+}
+
+int MMGManagerListModel::rowOf(QObject *row_value) const
+{
+	if (!row_value) return -1;
+
+	qsizetype index = valueIndex(row_value);
+	return _filter.isEmpty() ? index : filtered_rows.indexOf(index);
+}
+
+void MMGManagerListModel::setFilter(const QString &filter)
+{
+	if (_filter == filter) return;
+
+	beginResetModel();
+	_filter = filter;
+	applyFilter();
+	endResetModel();
+}
+
+void MMGManagerListModel::reset()
+{
+	beginResetModel();
+	applyFilter();
+	endResetModel();
+}
+
+void MMGManagerListModel::applyFilter()
+{
+	filtered_rows.clear();
+	if (_filter.isEmpty()) return;
+
+	for (qsizetype i = 0; i < valueCount(); ++i)
+		if (value(i)->objectName().contains(_filter, Qt::CaseInsensitive)) filtered_rows += i;
+}
+
+void MMGManagerListModel::insertValue(const MMGCallback &insert)
+{
+	if (!_filter.isEmpty()) {
+		insert();
+		reset();
+		return;
+	}
+
+	int row = valueCount();
+	beginInsertRows(QModelIndex(), row, row);
+	insert();
+	endInsertRows();
+}
+
+void MMGManagerListModel::removeValue(QObject *row_value, const MMGCallback &remove)
+{
+	int row = rowOf(row_value);
+	if (row < 0) {
+		remove();
+		reset();
+		return;
+	}
+
+	beginRemoveRows(QModelIndex(), row, row);
+	if (!_filter.isEmpty()) {
+		qsizetype index = filtered_rows.takeAt(row);
+		for (qsizetype &filtered_index : filtered_rows)
+			if (filtered_index > index) --filtered_index;
+	}
+	remove();
+	endRemoveRows();
+}
+// End MMGManagerListModel
+
 // MMGManagerDisplayQWidget
 MMGManagerDisplayQWidget::MMGManagerDisplayQWidget(QWidget *parent, QWidget *_info_widget, bool use_buttons)
 	: QWidget(parent)
@@ -70,25 +229,43 @@ MMGManagerDisplayQWidget::MMGManagerDisplayQWidget(QWidget *parent, QWidget *_in
 		layout->addWidget(buttons_header);
 	}
 
-	list_widget = new QListWidget(this);
-	list_widget->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
-	list_widget->setFocusPolicy(Qt::ClickFocus);
-	list_widget->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
-	list_widget->setStyleSheet("border-color: #000000;");
-	list_widget->setWordWrap(true);
-	list_widget->setDragDropMode(QListWidget::InternalMove);
-	list_widget->setDragEnabled(use_buttons);
-	list_widget->setAcceptDrops(use_buttons);
-	connect(list_widget, &QListWidget::itemSelectionChanged, this, &MMGManagerDisplayQWidget::itemShow);
-	connect(list_widget, &QListWidget::itemChanged, this, &MMGManagerDisplayQWidget::itemRename);
-	connect(list_widget->model(), &QAbstractItemModel::rowsMoved, this, &MMGManagerDisplayQWidget::itemMoved);
-	layout->addWidget(list_widget, 1);
+	if (use_buttons) {
+		filter_edit = new QLineEdit(this);
+		filter_edit->setClearButtonEnabled(true);
+		filter_edit->setPlaceholderText(mmgtr("UI.Filter"));
+		connect(filter_edit, &QLineEdit::textChanged, this, &MMGManagerDisplayQWidget::itemFiltered);
+		layout->addWidget(filter_edit);
+	}
+
+	list_view = new QListView(this);
+	list_view->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
+	list_view->setFocusPolicy(Qt::ClickFocus);
+	list_view->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+	list_view->setStyleSheet("border-color: #000000;");
+	list_view->setUniformItemSizes(true);
+	list_view->setLayoutMode(QListView::Batched);
+	list_view->setSelectionMode(QListView::SingleSelection);
+	list_view->setEditTriggers(QListView::DoubleClicked | QListView::EditKeyPressed);
+	list_view->setDragDropMode(QListView::InternalMove);
+	list_view->setDefaultDropAction(Qt::MoveAction);
+	list_view->setDragEnabled(use_buttons);
+	list_view->setAcceptDrops(use_buttons);
+	list_view->setDropIndicatorShown(use_buttons);
+	layout->addWidget(list_view, 1);
 
 	info_widget = _info_widget;
 	if (!!info_widget) layout->addWidget(info_widget);
 
 	setLayout(layout);
 }
+
+void MMGManagerDisplayQWidget::setModel(MMGManagerListModel *model)
+{
+	list_view->setModel(model);
+	connect(list_view->selectionModel(), &QItemSelectionModel::currentChanged, this,
+		&MMGManagerDisplayQWidget::itemShow);
+	connect(model, &MMGManagerListModel::valueRenamed, this, &MMGManagerDisplayQWidget::itemRenamed);
+}
 // End MMGManagerDisplayQWidget
 
 // MMGManagerDisplay<T>
@@ -96,84 +273,71 @@ template <typename T>
 MMGManagerDisplay<T>::MMGManagerDisplay(QWidget *parent, QWidget *info_widget, bool use_buttons)
 	: MMGManagerDisplayQWidget(parent, info_widget, use_buttons)
 {
+	model = new MMGManagerModel<T>(this, use_buttons);
+	setModel(model);
 }
 
 template <typename T> void MMGManagerDisplay<T>::setStorage(MMGManager<T> *manager)
 {
-	if (current_manager == manager) return;
+	if (model->manager() == manager) return;
 
-	current_manager = manager;
+	model->setManager(manager);
 	refresh();
 }
 
 template <typename T> void MMGManagerDisplay<T>::refreshCurrent(T *value)
 {
-	list_widget->blockSignals(true);
-
-	list_widget->clear();
-
-	if (!!current_manager) {
-		for (T *val : *current_manager) {
-			QListWidgetItem *new_item = new QListWidgetItem;
-			new_item->setFlags(Qt::ItemIsSelectable | Qt::ItemIsDragEnabled | Qt::ItemIsEnabled |
-					   (list_widget->acceptDrops() ? Qt::ItemIsEditable : Qt::NoItemFlags));
-			new_item->setText(val->objectName());
-			list_widget->addItem(new_item);
-		}
-	}
+	list_view->selectionModel()->blockSignals(true);
 
+	model->reset();
 	setCurrentValue(value);
 
-	list_widget->blockSignals(false);
+	list_view->selectionModel()->blockSignals(false);
 
 	itemShow();
 }
 
 template <typename T> void MMGManagerDisplay<T>::setCurrentValue(T *value)
 {
-	int index = current_manager->indexOf(value);
-	list_widget->setCurrentRow(!!value ? index : -1);
+	int row = model->rowOf(value);
+	list_view->setCurrentIndex(row >= 0 ? model->index(row) : QModelIndex());
 	if (current_value != value) itemShow();
 }
 
 template <typename T> void MMGManagerDisplay<T>::itemShow()
 {
-	int index = list_widget->currentRow();
-	current_value = index >= 0 ? current_manager->at(index) : nullptr;
+	current_value = static_cast<T *>(model->valueAt(list_view->currentIndex().row()));
 
 	if (!!current_value) emit itemRenamed(current_value->objectName());
 
 	if (!!info_widget) info_widget->setVisible(!!current_value);
 	if (!!copy_button) copy_button->setVisible(!!current_value);
-	if (!!remove_button) remove_button->setVisible(!!current_value && current_manager->size() > 1);
+	if (!!remove_button) remove_button->setVisible(!!current_value && model->manager()->size() > 1);
 
 	emit currentValueChanged();
 }
 
-template <typename T> void MMGManagerDisplay<T>::itemRename(QListWidgetItem *item)
-{
-	if (!item) return;
-	currentValue()->setObjectName(item->text());
-	emit itemRenamed(item->text());
-}
-
-template <typename T>
-void MMGManagerDisplay<T>::itemMoved(const QModelIndex &, int from, int, const QModelIndex &, int to)
+template <typename T> void MMGManagerDisplay<T>::itemFiltered()
 {
-	current_manager->move(from, to);
+	T *value = currentValue();
+	model->setFilter(filter_edit->text());
+	setCurrentValue(value);
+	itemShow();
 }
 
 template <typename T> void MMGManagerDisplay<T>::itemAdded()
 {
-	current_manager->add();
-	refreshCurrent(currentValue());
+	model->insertValue([this]() { model->manager()->add(); });
+	setCurrentValue(currentValue());
+	itemShow();
 }
 
 template <typename T> void MMGManagerDisplay<T>::itemCopied()
 {
 	if (!currentValue()) return;
-	current_manager->copy(currentValue());
-	refreshCurrent(currentValue());
+	model->insertValue([this]() { model->manager()->copy(currentValue()); });
+	setCurrentValue(currentValue());
+	itemShow();
 }
 
 template <typename T> void MMGManagerDisplay<T>::itemRemoved()
@@ -181,10 +345,15 @@ template <typename T> void MMGManagerDisplay<T>::itemRemoved()
 	if (!currentValue()) return;
 	if (!prompt_question("PermanentRemove")) return;
 
-	current_manager->remove(currentValue());
+	T *value = current_value;
 	current_value = nullptr;
 
-	refresh();
+	list_view->selectionModel()->blockSignals(true);
+	model->removeValue(value, [this, value]() { model->manager()->remove(value); });
+	list_view->setCurrentIndex(QModelIndex());
+	list_view->selectionModel()->blockSignals(false);
+
+	itemShow();
 }
 // End MMGManagerDisplay<T>
 
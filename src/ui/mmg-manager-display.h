@@ -22,11 +22,80 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 #include "../mmg-config.h"
 #include "mmg-value-widget.h"
 
-#include <QListWidget>
+#include <QAbstractListModel>
+#include <QLineEdit>
+#include <QListView>
 #include <QPushButton>
 
 namespace MMGWidgets {
 
+class MMGManagerListModel : public QAbstractListModel {
+	Q_OBJECT
+
+public:
+	MMGManagerListModel(QObject *parent, bool editable) : QAbstractListModel(parent), _editable(editable) {};
+	virtual ~MMGManagerListModel() = default;
+
+	int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+	QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+	bool setData(const QModelIndex &index, const QVariant &value, int role = Qt::EditRole) override;
+	Qt::ItemFlags flags(const QModelIndex &index) const override;
+
+	Qt::DropActions supportedDropActions() const override { return Qt::MoveAction; };
+	QStringList mimeTypes() const override;
+	QMimeData *mimeData(const QModelIndexList &indexes) const override;
+	bool dropMimeData(const QMimeData *data, Qt::DropAction action, int row, int, const QModelIndex &parent) override;
+	bool moveRows(const QModelIndex &source_parent, int source_row, int count, const QModelIndex &dest_parent,
+		      int dest_row) override;
+
+	QObject *valueAt(int row) const;
+	int rowOf(QObject *value) const;
+
+	void setFilter(const QString &filter);
+	void reset();
+	void insertValue(const MMGCallback &insert);
+	void removeValue(QObject *value, const MMGCallback &remove);
+
+signals:
+	void valueRenamed(const QString &name);
+
+protected:
+	virtual qsizetype valueCount() const = 0;
+	virtual QObject *value(qsizetype index) const = 0;
+	virtual qsizetype valueIndex(QObject *value) const = 0;
+	virtual void moveValue(qsizetype from, qsizetype to) = 0;
+
+private:
+	void applyFilter();
+
+private:
+	bool _editable;
+	QString _filter;
+	QList<qsizetype> filtered_rows;
+};
+
+template <typename T> class MMGManagerModel : public MMGManagerListModel {
+
+public:
+	MMGManagerModel(QObject *parent, bool editable) : MMGManagerListModel(parent, editable) {};
+
+	MMGManager<T> *manager() const { return _manager; };
+	void setManager(MMGManager<T> *manager)
+	{
+		_manager = manager;
+		reset();
+	};
+
+protected:
+	qsizetype valueCount() const override { return !!_manager ? _manager->size() : 0; };
+	QObject *value(qsizetype index) const override { return _manager->at(index); };
+	qsizetype valueIndex(QObject *value) const override { return _manager->indexOf(static_cast<T *>(value)); };
+	void moveValue(qsizetype from, qsizetype to) override { _manager->move(from, to); };
+
+private:
+	MMGManager<T> *_manager = nullptr;
+};
+
 class MMGManagerDisplayQWidget : public QWidget {
 	Q_OBJECT
 
@@ -42,22 +111,23 @@ signals:
 
 private slots:
 	virtual void itemShow() = 0;
-	virtual void itemRename(QListWidgetItem *item) = 0;
-	virtual void itemMoved(const QModelIndex &, int from, int, const QModelIndex &, int to) = 0;
+	virtual void itemFiltered() = 0;
 	virtual void itemAdded() = 0;
 	virtual void itemCopied() = 0;
 	virtual void itemRemoved() = 0;
 
 protected:
-	QListWidget *list_widget;
+	void setModel(MMGManagerListModel *model);
+
+protected:
+	QListView *list_view;
+	QLineEdit *filter_edit = nullptr;
 	QWidget *info_widget = nullptr;
 
 	QWidget *buttons_header;
 	QPushButton *add_button = nullptr;
 	QPushButton *copy_button = nullptr;
 	QPushButton *remove_button = nullptr;
-
-	static int dataRole() { return 260; };
 };
 
 template <typename T> class MMGManagerDisplay : public MMGManagerDisplayQWidget {
@@ -72,14 +142,13 @@ public:
 	void refresh() { refreshCurrent(nullptr); };
 
 private:
-	MMGManager<T> *current_manager = nullptr;
+	MMGManagerModel<T> *model;
 	T *current_value = nullptr;
 
 	void refreshCurrent(T *value);
 
 	void itemShow() override;
-	void itemRename(QListWidgetItem *item = nullptr) override;
-	void itemMoved(const QModelIndex &, int from, int, const QModelIndex &, int to) override;
+	void itemFiltered() override;
 	void itemAdded() override;
 	void itemCopied() override;
 	void itemRemoved() override;
@@ -21,6 +21,9 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 #include "../messages/mmg-message.h"
 #include "../mmg-config.h"
 
+#include <QGuiApplication>
+#include <QScreen>
+
 namespace MMGWidgets {
 
 MMGParams<MMGMIDIPort *> MMGMessageDisplay::device_params {
@@ -56,6 +59,13 @@ MMGMessageDisplay::MMGMessageDisplay(QWidget *parent, MMGStateDisplay *state_dis
 	connect(listen_button, &QPushButton::clicked, this, &MMGMessageDisplay::onListenClick);
 	connect(this, &MMGValueManager::modifyRequested, listen_button, &QPushButton::setVisible);
 	bottom_layout->addWidget(listen_button, 0, Qt::AlignBottom);
+
+	// Incoming messages are applied at most once per frame while listening
+	QScreen *screen = QGuiApplication::primaryScreen();
+	listen_timer = new QTimer(this);
+	listen_timer->setTimerType(Qt::PreciseTimer);
+	listen_timer->setInterval(1000 / std::max(qRound(!!screen ? screen->refreshRate() : 60.0), 1));
+	connect(listen_timer, &QTimer::timeout, this, &MMGMessageDisplay::drainMessage);
 }
 
 void MMGMessageDisplay::setStorage(DeviceType message_type, MMGMessageManager *parent, MMGMessage *storage)
@@ -74,6 +84,7 @@ void MMGMessageDisplay::setStorage(DeviceType message_type, MMGMessageManager *p
 
 	if (listening_mode > 0) resetListening();
 
+	editStorage(false);
 	if (!!_storage) disconnect(_storage, &QObject::destroyed, this, nullptr);
 	_parent = parent;
 	_storage = storage;
@@ -85,6 +96,7 @@ void MMGMessageDisplay::setStorage(DeviceType message_type, MMGMessageManager *p
 
 	_device = storage->device();
 	_id = storage->id();
+	editStorage(true);
 
 	resetMessage();
 }
@@ -93,8 +105,10 @@ void MMGMessageDisplay::setDevice()
 {
 	if (!_storage) return;
 	connectDevice(false);
+	editStorage(false);
 
 	_storage->setDevice(_device);
+	editStorage(true);
 	emit messageChanged();
 
 	listening_mode--;
@@ -103,7 +117,11 @@ void MMGMessageDisplay::setDevice()
 
 void MMGMessageDisplay::setType()
 {
-	if (MMGMessages::changeMessage(_parent, _storage, _id)) {
+	editStorage(false);
+	bool changed = MMGMessages::changeMessage(_parent, _storage, _id);
+	editStorage(true);
+
+	if (changed) {
 		resetMessage();
 		emit messageChanged();
 	}
@@ -130,10 +148,17 @@ void MMGMessageDisplay::connectDevice(bool connected)
 	_storage->device()->blockReceiver(this, connected);
 }
 
+void MMGMessageDisplay::editStorage(bool editing)
+{
+	if (!_storage || !_storage->device()) return;
+	_storage->device()->editReceiver(_storage, editing);
+}
+
 void MMGMessageDisplay::onListenClick()
 {
 	listening_mode++;
 	connectDevice(false);
+	listened_pending = false;
 
 	switch (listening_mode) {
 		default:
@@ -143,12 +168,14 @@ void MMGMessageDisplay::onListenClick()
 		case 0: // Listen for execution
 			listen_button->setChecked(false);
 			listen_button->setText(mmgtr("Message.Listen.Execution"));
+			listen_timer->stop();
 			mmgblog(LOG_DEBUG, "Listening deactivated.");
 			break;
 
 		case 1: // Listen once
 			listen_button->setChecked(true);
 			listen_button->setText(mmgtr("Message.Listen.Once"));
+			listen_timer->start();
 			connectDevice(true);
 			mmgblog(LOG_DEBUG, "Single listen activated.");
 			break;
@@ -156,6 +183,7 @@ void MMGMessageDisplay::onListenClick()
 		case 2: // Listen continuously
 			listen_button->setChecked(true);
 			listen_button->setText(mmgtr("Message.Listen.Continuous"));
+			listen_timer->start();
 			connectDevice(true);
 			mmgblog(LOG_DEBUG, "Continuous listen activated.");
 			break;
@@ -169,22 +197,33 @@ void MMGMessageDisplay::processMessage(const MMGMessageData &incoming)
 		return;
 	}
 
+	if (!id_params.bounds.contains(MMGMessages::Id(0x4000 | incoming.status()))) return;
+
+	listened_message = incoming;
+	listened_pending = true;
+}
+
+void MMGMessageDisplay::drainMessage()
+{
+	if (!listened_pending.exchange(false)) return;
+	MMGMessageData incoming = listened_message;
+
 	MMGMessages::Id old_id = _id;
-	MMGMessages::Id new_id = MMGMessages::Id(0x4000 | incoming.status());
-	if (!id_params.bounds.contains(new_id)) return;
+	_id = MMGMessages::Id(0x4000 | incoming.status());
 
 	if (listening_mode == 1) resetListening();
-	_id = new_id;
+	if (!_storage) return;
 
 	if (old_id == _id) {
 		_storage->copyFromMessageData(incoming);
 		refreshAll();
 	} else {
-		runInMainThread([this, incoming]() {
-			MMGMessages::changeMessage(_parent, _storage, _id);
-			_storage->copyFromMessageData(incoming);
-			resetMessage();
-		});
+		editStorage(false);
+		MMGMessages::changeMessage(_parent, _storage, _id);
+		editStorage(true);
+
+		_storage->copyFromMessageData(incoming);
+		resetMessage();
 	}
 }
 
@@ -22,6 +22,10 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 #include "../messages/mmg-message.h"
 #include "mmg-value-manager.h"
 
+#include <atomic>
+
+#include <QTimer>
+
 namespace MMGWidgets {
 
 class MMGMessageDisplay : public MMGValueManager, public MMGMessageReceiver {
@@ -44,8 +48,10 @@ private:
 	void resetMessage();
 
 	void connectDevice(bool);
+	void editStorage(bool);
 	void onListenClick();
 	void processMessage(const MMGMessageData &) override;
+	void drainMessage();
 
 private:
 	MMGMessageManager *_parent = nullptr;
@@ -57,6 +63,10 @@ private:
 	QPushButton *listen_button;
 	short listening_mode = 0;
 
+	QTimer *listen_timer;
+	std::atomic<MMGMessageData> listened_message;
+	std::atomic_bool listened_pending = false;
+
 	static MMGParams<MMGMIDIPort *> device_params;
 	static MMGParams<MMGMessages::Id> id_params;
 };
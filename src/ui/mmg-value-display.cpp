@@ -131,6 +131,13 @@ MMGValueFixedDisplay<T>::MMGValueFixedDisplay(QWidget *parent, const MMGParams<T
 	connectEditor();
 }
 
+template <typename T> void MMGValueFixedDisplay<T>::rebind(const MMGParams<T> *params, MMGValue<T> *storage)
+{
+	_params = params;
+	_storage = storage;
+	setModifiable(true);
+}
+
 template <typename T> void MMGValueFixedDisplay<T>::setDescription(const QString &desc)
 {
 	_label->setText(desc);
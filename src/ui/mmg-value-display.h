@@ -141,6 +141,7 @@ public:
 	using MMGValueDisplay<T>::setValue;
 
 	bool hasStorage() const override { return !!_storage; };
+	void rebind(const MMGParams<T> *params, MMGValue<T> *storage);
 	using MMGValueDisplay<T>::setModifiable;
 	void setDescription(const QString &desc);
 	void refresh() override;
@@ -116,12 +116,30 @@ void MMGValueManager::removeExcept(int32_t remaining)
 		    !!state_info && state_infos.contains(state_info))
 			state_infos.removeOne(state_info);
 
-		disconnect(this, &MMGValueManager::refreshRequested, next->widget(), nullptr);
-		delete next->widget();
+		if (auto *value_display = dynamic_cast<MMGValueQWidget *>(next->widget()); !!value_display) {
+			releaseToPool(value_display);
+		} else {
+			disconnect(this, &MMGValueManager::refreshRequested, next->widget(), nullptr);
+			delete next->widget();
+		}
 		delete next;
 	}
 }
 
+void MMGValueManager::releaseToPool(MMGValueQWidget *value_display)
+{
+	if (current_value_display_editor == value_display) {
+		clearEditRequest();
+		if (!!state_display) state_display->clearStorage();
+	}
+
+	disconnect(value_display, nullptr, this, nullptr);
+	disconnect(this, nullptr, value_display, nullptr);
+	value_display->hide();
+
+	display_pool.insert(typeid(*value_display).hash_code(), value_display);
+}
+
 void MMGValueManager::clear()
 {
 	removeAll();
@@ -22,6 +22,8 @@ with this program. If not, see <https://www.gnu.org/licenses/>
 #include "mmg-state-display.h"
 #include "mmg-value-display.h"
 
+#include <typeinfo>
+
 namespace MMGWidgets {
 
 class MMGValueManager : public QWidget {
@@ -36,7 +38,8 @@ public:
 	template <typename T> void addNew(MMGValue<T> *storage, const MMGParams<T> *params, const MMGCallback &cb = 0)
 	{
 		if (params->options != OPTION_NONE) {
-			auto *state_display = new MMGValueStateDisplay<T>(this, params, storage);
+			auto *state_display = takePooled<MMGValueStateDisplay<T>>(params, storage);
+			if (!state_display) state_display = new MMGValueStateDisplay<T>(this, params, storage);
 			state_infos += state_display;
 
 			connect(state_display, &MMGValueQWidget::editRequested, this,
@@ -46,7 +49,8 @@ public:
 		} else {
 			storage->template changeTo<STATE_FIXED>();
 
-			auto *fixed_display = new MMGValueFixedDisplay<T>(this, params, storage);
+			auto *fixed_display = takePooled<MMGValueFixedDisplay<T>>(params, storage);
+			if (!fixed_display) fixed_display = new MMGValueFixedDisplay<T>(this, params, storage);
 			connectNew(fixed_display, cb);
 			scroll_layout->addWidget(fixed_display);
 		}
@@ -82,6 +86,15 @@ private:
 	void connectNew(MMGValueQWidget *value_display, const MMGCallback &cb);
 	void sendRefresh(MMGValueQWidget *value_display);
 
+	// Removed value displays are kept hidden and rebound instead of being reconstructed
+	template <typename Display, typename T> Display *takePooled(const MMGParams<T> *params, MMGValue<T> *storage)
+	{
+		auto *value_display = static_cast<Display *>(display_pool.take(typeid(Display).hash_code()));
+		if (!!value_display) value_display->rebind(params, storage);
+		return value_display;
+	};
+	void releaseToPool(MMGValueQWidget *value_display);
+
 	template <typename T> void sendEditRequest()
 	{
 		if (!state_display) return;
@@ -118,6 +131,8 @@ protected:
 private:
 	MMGValueQWidget *current_value_display_editor = nullptr;
 	MMGStateDisplay *state_display;
+
+	QMultiHash<size_t, MMGValueQWidget *> display_pool;
 };
 
 } // namespace MMGWidgets
@@ -0,0 +1,77 @@
+/*
+obs-midi-mg
+Copyright (C) 2022-2026 nhielost <nhielost@gmail.com>
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program. If not, see <https://www.gnu.org/licenses/>
+*/
+
+#include "mmg-bench.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace MMGBench;
+
+// Runs one action on the harness's source, as a fulfilled binding would (but on this thread)
+static void executeAction(benchmark::State &state, QJsonObject action_obj)
+{
+	useConfiguration(100);
+
+	action_obj["name"] = "Action";
+	action_obj["source"] = fixedValue<MMGString>(benchSourceUUID());
+
+	QJsonObject binding_obj;
+	binding_obj["name"] = "Action Binding";
+	binding_obj["enabled"] = false;
+	binding_obj["type"] = TYPE_INPUT;
+	binding_obj["actions"] = QJsonArray {action_obj};
+
+	MMGBinding *binding = firstCollection()->add(binding_obj);
+	MMGAction *action = binding->actions(0);
+
+	MMGMappingTest test;
+	for (auto _ : state)
+		action->execute(test);
+	state.SetItemsProcessed(state.iterations());
+
+	firstCollection()->remove(binding);
+	processEvents();
+}
+
+static void BM_ActionVolumeIncrement(benchmark::State &state)
+{
+	QJsonObject action_obj;
+	action_obj["id"] = 0x1301;
+	action_obj["format"] = fixedValue<MMGString>("%");
+	action_obj["volume"] = incrementValue<float>(1.0f);
+	executeAction(state, action_obj);
+}
+BENCHMARK(BM_ActionVolumeIncrement);
+
+static void BM_ActionMuteToggle(benchmark::State &state)
+{
+	QJsonObject action_obj;
+	action_obj["id"] = 0x1302;
+	action_obj["muted"] = QJsonObject {{"state", STATE_TOGGLE}};
+	executeAction(state, action_obj);
+}
+BENCHMARK(BM_ActionMuteToggle);
+
+static void BM_ActionMediaTimeIncrement(benchmark::State &state)
+{
+	QJsonObject action_obj;
+	action_obj["id"] = 0x13a2;
+	action_obj["time"] = incrementValue<int64_t>(1);
+	executeAction(state, action_obj);
+}
+BENCHMARK(BM_ActionMediaTimeIncrement);
@@ -0,0 +1,84 @@
+/*
+obs-midi-mg
+Copyright (C) 2022-2026 nhielost <nhielost@gmail.com>
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program. If not, see <https://www.gnu.org/licenses/>
+*/
+
+#include "mmg-bench.h"
+
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+using namespace MMGBench;
+
+static QJsonArray savedBindings(const MMGBindingManager *collection)
+{
+	QJsonObject json_obj;
+	collection->json(json_obj);
+	return json_obj["bindings"].toArray();
+}
+
+static void removeCollection(MMGBindingManager *collection)
+{
+	config()->collections()->remove(collection);
+	processEvents();
+}
+
+TEST(Collections, DuplicatesEveryBinding)
+{
+	useConfiguration(1000);
+
+	MMGBindingManager *duplicate = config()->collections()->copy(firstCollection());
+	ASSERT_NE(duplicate, nullptr);
+	EXPECT_NE(duplicate->objectName(), firstCollection()->objectName());
+	EXPECT_EQ(savedBindings(duplicate), savedBindings(firstCollection()));
+
+	removeCollection(duplicate);
+}
+
+// Cloned directly, as the editor's copy button does
+static void BM_CollectionDuplicate(benchmark::State &state)
+{
+	useConfiguration(state.range(0));
+
+	for (auto _ : state) {
+		MMGBindingManager *duplicate = config()->collections()->copy(firstCollection());
+
+		state.PauseTiming();
+		removeCollection(duplicate);
+		state.ResumeTiming();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CollectionDuplicate)->Arg(2000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+// Written to JSON and generated again, as collections were duplicated before direct clones
+static void BM_CollectionDuplicateJSON(benchmark::State &state)
+{
+	useConfiguration(state.range(0));
+
+	for (auto _ : state) {
+		QJsonObject json_obj;
+		json_obj["name"] = "Duplicate";
+		firstCollection()->json(json_obj);
+		MMGBindingManager *duplicate = config()->collections()->add(json_obj);
+
+		state.PauseTiming();
+		removeCollection(duplicate);
+		state.ResumeTiming();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CollectionDuplicateJSON)->Arg(2000)->Arg(10000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,178 @@
+/*
+obs-midi-mg
+Copyright (C) 2022-2026 nhielost <nhielost@gmail.com>
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program. If not, see <https://www.gnu.org/licenses/>
+*/
+
+#include "mmg-bench.h"
+
+#include <QFileInfo>
+
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+using namespace MMGBench;
+
+static QJsonObject savedCollection(const QString &path)
+{
+	config()->save(path);
+
+	QFile file(path);
+	[[maybe_unused]] bool fileOpen = file.open(QFile::ReadOnly | QFile::Text);
+	return MMGJson::toObject(file.readAll())["collections"].toArray()[0].toObject();
+}
+
+TEST(Config, SavesWhatItLoaded)
+{
+	loadConfiguration(100);
+	ASSERT_EQ(firstCollection()->size(), 100);
+
+	QJsonObject saved = savedCollection(scratchPath("saved.json"));
+	config()->load(scratchPath("saved.json"));
+	config()->finishLoad();
+	processEvents();
+
+	EXPECT_EQ(savedCollection(scratchPath("resaved.json")), saved);
+	EXPECT_EQ(saved["bindings"].toArray().size(), 100);
+}
+
+// Forcing a serial decode, whatever the number of bindings
+struct SerialDecoding {
+	SerialDecoding(bool serial = true) : minimum(MMGBinding::parallel_decoding_minimum)
+	{
+		if (serial) MMGBinding::parallel_decoding_minimum = std::numeric_limits<qsizetype>::max();
+	};
+	~SerialDecoding() { MMGBinding::parallel_decoding_minimum = minimum; };
+
+	qsizetype minimum;
+};
+
+TEST(Config, DecodesInParallelAsInSerial)
+{
+	loadConfiguration(1000);
+	QJsonObject parallel = savedCollection(scratchPath("parallel.json"));
+	{
+		SerialDecoding serial;
+		loadConfiguration(1000);
+	}
+
+	EXPECT_EQ(savedCollection(scratchPath("serial.json")), parallel);
+}
+
+TEST(Config, LoadsDisabledCollectionsWhenUsed)
+{
+	QJsonObject config_obj = configuration(100);
+	QJsonObject collection_obj = config_obj["collections"].toArray()[0].toObject();
+	QJsonArray binding_arr;
+	for (const QJsonValue &binding_val : collection_obj["bindings"].toArray()) {
+		QJsonObject binding_obj = binding_val.toObject();
+		binding_obj["enabled"] = false;
+		binding_arr += binding_obj;
+	}
+	collection_obj["bindings"] = binding_arr;
+	config_obj["collections"] = QJsonArray {collection_obj};
+
+	QFile file(scratchPath("disabled.json"));
+	[[maybe_unused]] bool fileOpen = file.open(QFile::WriteOnly | QFile::Text);
+	file.write(MMGJson::toString(config_obj));
+	file.close();
+
+	config()->load(file.fileName());
+	config()->finishLoad();
+	ASSERT_TRUE(firstCollection()->deferred());
+
+	EXPECT_EQ(firstCollection()->size(), 100);
+	EXPECT_FALSE(firstCollection()->deferred());
+	EXPECT_EQ(firstCollection()->at(99)->objectName(), "Binding 100");
+	EXPECT_FALSE(firstCollection()->at(99)->enabled());
+
+	loadConfiguration(100);
+}
+
+TEST(Config, LoadsCBORAsJSON)
+{
+	loadConfiguration(100, true);
+	QJsonObject from_cbor = savedCollection(scratchPath("from-cbor.json"));
+	loadConfiguration(100);
+
+	EXPECT_EQ(savedCollection(scratchPath("from-json.json")), from_cbor);
+}
+
+// Loading decodes bindings on the thread pool, so these are timed by the wall clock
+static void BM_ConfigLoad(benchmark::State &state)
+{
+	for (auto _ : state)
+		loadConfiguration(state.range(0));
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ConfigLoad)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_ConfigSave(benchmark::State &state)
+{
+	useConfiguration(state.range(0));
+	QString path = scratchPath("save.json");
+
+	for (auto _ : state)
+		config()->save(path);
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ConfigSave)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// The same configuration stored as JSON (0) or CBOR (1)
+static void BM_ConfigLoadFormat(benchmark::State &state)
+{
+	for (auto _ : state)
+		loadConfiguration(state.range(0), state.range(1));
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ConfigLoadFormat)
+	->ArgNames({"bindings", "cbor"})
+	->Args({10000, 0})
+	->Args({10000, 1})
+	->Unit(benchmark::kMillisecond)
+	->UseRealTime();
+
+static void BM_ConfigSaveFormat(benchmark::State &state)
+{
+	useConfiguration(state.range(0));
+	QString path = scratchPath(state.range(1) ? "save.cbor" : "save.json");
+
+	for (auto _ : state)
+		config()->save(path);
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	state.counters["bytes"] = QFileInfo(path).size();
+}
+BENCHMARK(BM_ConfigSaveFormat)
+	->ArgNames({"bindings", "cbor"})
+	->Args({10000, 0})
+	->Args({10000, 1})
+	->Unit(benchmark::kMillisecond)
+	->UseRealTime();
+
+// Bindings decoded on the thread pool (0) or one after another (1)
+static void BM_ConfigLoadDecoding(benchmark::State &state)
+{
+	SerialDecoding serial(state.range(1));
+
+	for (auto _ : state)
+		loadConfiguration(state.range(0));
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ConfigLoadDecoding)
+	->ArgNames({"bindings", "serial"})
+	->Args({10000, 0})
+	->Args({10000, 1})
+	->Unit(benchmark::kMillisecond)
+	->UseRealTime();
@@ -0,0 +1,122 @@
+/*
+obs-midi-mg
+Copyright (C) 2022-2026 nhielost <nhielost@gmail.com>
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program. If not, see <https://www.gnu.org/licenses/>
+*/
+
+#include "mmg-bench.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace MMGBench;
+
+// The fields of a note message, tested in the order that MMGMessageNote tests them
+// (so the velocity is reference index 3)
+struct NoteFields {
+	MMG8Bit group;
+	MMG8Bit channel;
+	MMG8Bit note;
+	MMG16Bit velocity;
+
+	NoteFields()
+	{
+		group = 1;
+		channel = 1;
+		note = 60;
+
+		auto *range = velocity.changeTo<STATE_RANGE>();
+		range->setMin(0);
+		range->setMax(127);
+	};
+
+	MMGMappingTest accept(uint16_t incoming_velocity) const
+	{
+		MMGMappingTest test;
+		test.addAcceptable(group, uint8_t(1), false);
+		test.addAcceptable(channel, uint8_t(1));
+		test.addAcceptable(note, uint8_t(60));
+		test.addAcceptable(velocity, incoming_velocity);
+		return test;
+	};
+};
+
+static void BM_MappingAccept(benchmark::State &state)
+{
+	NoteFields fields;
+
+	uint16_t velocity = 0;
+	for (auto _ : state) {
+		MMGMappingTest test = fields.accept(velocity++ % 128);
+		benchmark::DoNotOptimize(test.valid());
+	}
+}
+BENCHMARK(BM_MappingAccept);
+
+static MMGFloat volumeValue(ValueState value_state)
+{
+	MMGFloat value;
+	switch (value_state) {
+		case STATE_FIXED:
+		default:
+			value = 50.0f;
+			break;
+
+		case STATE_MIDI: {
+			auto *map = value.changeTo<STATE_MIDI>();
+			map->setSize(128);
+			for (int64_t i = 0; i < 128; ++i)
+				map->setValue(i, i * 100.0f / 127.0f);
+			map->setReferenceIndex(MMGStates::REFIDX_3);
+		} break;
+
+		case STATE_RANGE: {
+			auto *range = value.changeTo<STATE_RANGE>();
+			range->setMin(0.0f);
+			range->setMax(100.0f);
+			range->setReferenceIndex(MMGStates::REFIDX_3);
+		} break;
+
+		case STATE_TOGGLE: {
+			auto *toggle = value.changeTo<STATE_TOGGLE>();
+			toggle->setSize(2);
+			toggle->set(0, 0.0f);
+			toggle->set(1, 100.0f);
+		} break;
+
+		case STATE_INCREMENT:
+			value.changeTo<STATE_INCREMENT>()->setIncrement(1.0f);
+			break;
+	}
+	return value;
+}
+
+// As an action applies a fulfilled test to one of its values
+template <ValueState State> static void BM_MappingApply(benchmark::State &state)
+{
+	NoteFields fields;
+	MMGMappingTest test = fields.accept(100);
+	MMGFloat value = volumeValue(State);
+
+	for (auto _ : state) {
+		float result = 50.0f;
+		benchmark::DoNotOptimize(test.applicable(value, result));
+		benchmark::DoNotOptimize(result);
+	}
+}
+BENCHMARK(BM_MappingApply<STATE_FIXED>);
+BENCHMARK(BM_MappingApply<STATE_MIDI>);
+BENCHMARK(BM_MappingApply<STATE_RANGE>);
+BENCHMARK(BM_MappingApply<STATE_TOGGLE>);
+BENCHMARK(BM_MappingApply<STATE_INCREMENT>);
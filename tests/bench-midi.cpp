@@ -0,0 +1,258 @@
+/*
+obs-midi-mg
+Copyright (C) 2022-2026 nhielost <nhielost@gmail.com>
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program. If not, see <https://www.gnu.org/licenses/>
+*/
+
+#include "mmg-bench.h"
+#include "mmg-device.h"
+#include "mmg-midi-conditions.h"
+
+#include <QDeadlineTimer>
+#include <QThread>
+
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+using namespace MMGBench;
+
+// Only the messages' tests run, since their bindings are disabled
+static QList<MMGMessageReceiver *> disabledReceivers(qsizetype bindings)
+{
+	useConfiguration(bindings);
+
+	QList<MMGMessageReceiver *> receivers;
+	for (MMGBinding *binding : *firstCollection()) {
+		binding->setEnabled(false);
+		receivers += binding->messages(0);
+	}
+	return receivers;
+}
+
+// The binding that listens for each incoming message
+static qsizetype messageTarget(qsizetype i, qsizetype bindings)
+{
+	return i * 7919 % bindings;
+}
+
+// Note messages spread over every channel and note that the bindings listen for
+static QList<MMGMessageData> incomingMessages(qsizetype bindings)
+{
+	QList<MMGMessageData> messages;
+	for (qsizetype i = 0; i < 256; ++i) {
+		qsizetype target = messageTarget(i, bindings);
+		messages += midi1Message(MMGMessages::NOTE_ON, target / 128 % 16 + 1, target % 128, i % 128);
+	}
+	return messages;
+}
+
+TEST(MIDI, ConditionsMatchTheirReceivers)
+{
+	QList<MMGMessageReceiver *> receivers = disabledReceivers(1000);
+	QList<MMGMessageData> messages = incomingMessages(1000);
+
+	MMGMIDIConditions::Table table;
+	for (MMGMessageReceiver *rec : receivers)
+		table.add(rec);
+
+	for (qsizetype i = 0; i < messages.size(); ++i) {
+		MMGMIDIConditions::Matches matches;
+		table.match(messages[i], matches);
+
+		EXPECT_TRUE(matches.contains(receivers[messageTarget(i, 1000)]));
+		EXPECT_LT(matches.size(), receivers.size());
+	}
+}
+
+// As MMGMIDIPort::callback dispatches a message once it is complete
+static void BM_DispatchTable(benchmark::State &state)
+{
+	QList<MMGMessageReceiver *> receivers = disabledReceivers(state.range(0));
+	QList<MMGMessageData> messages = incomingMessages(state.range(0));
+
+	MMGMIDIConditions::Table table;
+	for (MMGMessageReceiver *rec : receivers)
+		table.add(rec);
+
+	qsizetype i = 0;
+	for (auto _ : state) {
+		const MMGMessageData &message = messages[i++ % messages.size()];
+
+		MMGMIDIConditions::Matches matches;
+		table.match(message, matches);
+		for (auto *rec : matches)
+			rec->processMessage(message);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DispatchTable)->Arg(100)->Arg(1000)->Arg(10000);
+
+// Every receiver running its full test, as messages were dispatched before the conditions table
+static void BM_DispatchLoop(benchmark::State &state)
+{
+	QList<MMGMessageReceiver *> receivers = disabledReceivers(state.range(0));
+	QList<MMGMessageData> messages = incomingMessages(state.range(0));
+
+	qsizetype i = 0;
+	for (auto _ : state) {
+		const MMGMessageData &message = messages[i++ % messages.size()];
+
+		for (auto *rec : receivers)
+			rec->processMessage(message);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DispatchLoop)->Arg(1000)->Arg(10000);
+
+// Keeps everything a port dispatches to it
+class RecordingReceiver : public MMGMessageReceiver {
+public:
+	void processMessage(const MMGMessageData &data) override
+	{
+		std::scoped_lock lock(mutex);
+		received += data;
+	};
+
+	QList<MMGMessageData> messages() const
+	{
+		std::scoped_lock lock(mutex);
+		return received;
+	};
+
+private:
+	mutable std::mutex mutex;
+	QList<MMGMessageData> received;
+};
+
+// A note on (velocity 100) and off from a MIDI 1.0 loopback port, as received in either message mode
+static QList<MMGMessageData> generatedNote(bool midi2)
+{
+	useConfiguration(100);
+	setMessageMode(midi2);
+
+	auto *device = static_cast<MMGDevice *>(addLoopbackDevice(MMGMIDILoopback::NONE));
+	device->setActive(TYPE_INPUT, true);
+
+	RecordingReceiver receiver;
+	device->connectReceiver(&receiver, true);
+
+	MMGMIDILoopback::Settings settings;
+	settings.pattern = MMGMIDILoopback::NOTE_STORM;
+	settings.channel = 3;
+	settings.control = 60;
+	settings.rate = 0;
+	settings.count = 2;
+	device->startGenerator(settings);
+
+	QDeadlineTimer deadline(5000);
+	while (receiver.messages().size() < 2 && !deadline.hasExpired())
+		QThread::msleep(1);
+
+	device->stopGenerator();
+	device->connectReceiver(&receiver, false);
+	config()->devices()->remove(device);
+	setMessageMode(false);
+	processEvents();
+
+	return receiver.messages();
+}
+
+TEST(MIDI, ReadsMIDI1PortsInMIDI2Mode)
+{
+	QList<MMGMessageData> messages = generatedNote(true);
+	ASSERT_EQ(messages.size(), 2);
+
+	const MMGMessageData &note_on = messages[0];
+	EXPECT_EQ(note_on.type(), MMGMessages::MIDI2_CV);
+	EXPECT_EQ(note_on.status(), MMGMessages::NOTE_ON);
+	EXPECT_EQ(note_on.get<12, 4>(), 2u);
+	EXPECT_EQ(note_on.get<16, 8>(), 60u);
+	// 100 scaled up to 16 bits, keeping the center of the range at its center
+	EXPECT_EQ(note_on.get<32, 16>(), 0xc924u);
+
+	EXPECT_EQ(messages[1].type(), MMGMessages::MIDI2_CV);
+	EXPECT_EQ(messages[1].status(), MMGMessages::NOTE_OFF);
+}
+
+TEST(MIDI, ReadsMIDI1PortsInMIDI1Mode)
+{
+	QList<MMGMessageData> messages = generatedNote(false);
+	ASSERT_EQ(messages.size(), 2);
+
+	const MMGMessageData &note_on = messages[0];
+	EXPECT_EQ(note_on.type(), MMGMessages::MIDI1_CV);
+	EXPECT_EQ(note_on.status(), MMGMessages::NOTE_ON);
+	EXPECT_EQ(note_on.get<12, 4>(), 2u);
+	EXPECT_EQ(note_on.get<16, 8>(), 60u);
+	EXPECT_EQ(note_on.get<24, 8>(), 100u);
+}
+
+// Conversions done for every message whose port protocol differs from the message mode, and for every send
+static QList<MMGMessageData> conversionMessages(MMGMessages::Type protocol)
+{
+	constexpr MMGMessages::ChannelStatusCode statuses[] = {
+		MMGMessages::NOTE_OFF,         MMGMessages::NOTE_ON,          MMGMessages::POLY_PRESSURE,
+		MMGMessages::CONTROL_CHANGE,   MMGMessages::PROGRAM_CHANGE,   MMGMessages::CHANNEL_PRESSURE,
+		MMGMessages::PITCH_BEND,
+	};
+
+	QList<MMGMessageData> messages;
+	for (qsizetype i = 0; i < 256; ++i)
+		messages += midi1Message(statuses[i % std::size(statuses)], i % 16 + 1, i * 5, i * 3)
+				    .toProtocol(protocol);
+	return messages;
+}
+
+static void BM_ConvertToMIDI2(benchmark::State &state)
+{
+	QList<MMGMessageData> messages = conversionMessages(MMGMessages::MIDI1_CV);
+
+	qsizetype i = 0;
+	for (auto _ : state)
+		benchmark::DoNotOptimize(messages[i++ % messages.size()].toProtocol(MMGMessages::MIDI2_CV));
+}
+BENCHMARK(BM_ConvertToMIDI2);
+
+static void BM_ConvertToMIDI1(benchmark::State &state)
+{
+	QList<MMGMessageData> messages = conversionMessages(MMGMessages::MIDI2_CV);
+
+	qsizetype i = 0;
+	for (auto _ : state)
+		benchmark::DoNotOptimize(messages[i++ % messages.size()].toProtocol(MMGMessages::MIDI1_CV));
+}
+BENCHMARK(BM_ConvertToMIDI1);
+
+// As sent to a MIDI 2.0 (UMP) port, from either message mode
+static void BM_ConvertToUMP(benchmark::State &state)
+{
+	QList<MMGMessageData> messages = conversionMessages(MMGMessages::Type(state.range(0)));
+
+	qsizetype i = 0;
+	for (auto _ : state)
+		benchmark::DoNotOptimize(libremidi::ump(messages[i++ % messages.size()]));
+}
+BENCHMARK(BM_ConvertToUMP)->Arg(MMGMessages::MIDI1_CV)->Arg(MMGMessages::MIDI2_CV);
+
+// As sent to a MIDI 1.0 port, from either message mode
+static void BM_ConvertToMessage(benchmark::State &state)
+{
+	QList<MMGMessageData> messages = conversionMessages(MMGMessages::Type(state.range(0)));
+
+	qsizetype i = 0;
+	for (auto _ : state)
+		benchmark::DoNotOptimize(libremidi::message(messages[i++ % messages.size()]));
+}
+BENCHMARK(BM_ConvertToMessage)->Arg(MMGMessages::MIDI1_CV)->Arg(MMGMessages::MIDI2_CV);
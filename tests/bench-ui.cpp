@@ -0,0 +1,79 @@
+/*
+obs-midi-mg
+Copyright (C) 2022-2026 nhielost <nhielost@gmail.com>
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program. If not, see <https://www.gnu.org/licenses/>
+*/
+
+#include "mmg-bench.h"
+#include "ui/mmg-action-display.h"
+#include "ui/mmg-state-display.h"
+
+#include <QVBoxLayout>
+
+#include <benchmark/benchmark.h>
+
+using namespace MMGBench;
+using namespace MMGWidgets;
+
+// A mix of action kinds, so that value displays are recycled between kinds as well as within them
+static MMGBinding *actionBinding(qsizetype actions)
+{
+	constexpr uint16_t ids[] = {0x0101, 0x1101, 0x1301, 0x1302, 0x13a2, 0x1401};
+
+	QJsonArray action_arr;
+	for (qsizetype i = 0; i < actions; ++i) {
+		QJsonObject action_obj;
+		action_obj["name"] = QString("Action %1").arg(i + 1);
+		action_obj["id"] = ids[i % std::size(ids)];
+		action_obj["source"] = fixedValue<MMGString>(benchSourceUUID());
+		action_arr += action_obj;
+	}
+
+	QJsonObject binding_obj;
+	binding_obj["name"] = "Action Binding";
+	binding_obj["enabled"] = false;
+	binding_obj["type"] = TYPE_INPUT;
+	binding_obj["actions"] = action_arr;
+	return firstCollection()->add(binding_obj);
+}
+
+// Each iteration selects every action in turn, as MMGEchoWindow::actionShow does
+static void BM_UIActionScroll(benchmark::State &state)
+{
+	useConfiguration(100);
+	MMGBinding *binding = actionBinding(state.range(0));
+
+	auto *window = new QWidget;
+	auto *layout = new QVBoxLayout(window);
+	auto *state_display = new MMGStateDisplay(window);
+	auto *action_display = new MMGActionDisplay(window, state_display);
+	layout->addWidget(action_display);
+	layout->addWidget(state_display);
+
+	for (auto _ : state) {
+		for (MMGAction *action : *binding->actions()) {
+			state_display->applyReferences(binding->type(), TYPE_INPUT);
+			action_display->setStorage(binding->type(), binding->actions(), action);
+			action_display->setModifiable(true);
+			processEvents();
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+
+	delete window;
+	firstCollection()->remove(binding);
+	processEvents();
+}
+BENCHMARK(BM_UIActionScroll)->Arg(1000)->Unit(benchmark::kMillisecond);
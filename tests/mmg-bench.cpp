@@ -0,0 +1,279 @@
+/*
+obs-midi-mg
+Copyright (C) 2022-2026 nhielost <nhielost@gmail.com>
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program. If not, see <https://www.gnu.org/licenses/>
+*/
+
+#include "mmg-bench.h"
+#include "mmg-preference-defs.h"
+#include "actions/mmg-action-scene-items.h"
+
+#include <QApplication>
+
+#include <util/text-lookup.h>
+
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+// Module glue, in place of obs-midi-mg.cpp
+OBS_DECLARE_MODULE()
+
+static lookup_t *module_lookup = nullptr;
+static MMGConfig *global_config = nullptr;
+
+const char *obs_module_text(const char *val)
+{
+	const char *out = val;
+	text_lookup_getstr(module_lookup, val, &out);
+	return out;
+}
+
+QDataStream &operator<<(QDataStream &out, const QObject *&obj)
+{
+	return out << *(quint64 *)(&obj);
+}
+
+QDataStream &operator>>(QDataStream &in, QObject *&obj)
+{
+	quint64 data;
+	in >> data;
+	obj = *(QObject **)(&data);
+	return in;
+}
+
+void mmgblog(int log_status, const QString &message)
+{
+	blog(log_status, "[obs-midi-mg] %s", qUtf8Printable(message));
+}
+
+void runInMainThread(const MMGCallback &func)
+{
+	QMetaObject::invokeMethod(qApp, func, Qt::QueuedConnection);
+}
+
+MMGConfig *config()
+{
+	return global_config;
+}
+// End module glue
+
+namespace MMGBench {
+
+static QTemporaryDir *scratch_dir = nullptr;
+static obs_source_t *bench_source = nullptr;
+static qsizetype loaded_bindings = -1;
+
+// Only warnings and errors are printed, so that results stay readable
+static void logHandler(int log_level, const char *format, va_list args, void *)
+{
+	if (log_level > LOG_WARNING && !qEnvironmentVariableIsSet("OBS_MIDIMG_BENCH_VERBOSE")) return;
+
+	vfprintf(stderr, format, args);
+	fputc('\n', stderr);
+}
+
+static void registerBenchSource()
+{
+	obs_source_info info = {};
+	info.id = "mmg_bench_source";
+	info.type = OBS_SOURCE_TYPE_INPUT;
+	info.output_flags = OBS_SOURCE_AUDIO | OBS_SOURCE_CONTROLLABLE_MEDIA;
+	info.get_name = [](void *) -> const char * { return "obs-midi-mg Bench Source"; };
+	info.create = [](obs_data_t *, obs_source_t *) -> void * { return new int64_t(0); };
+	info.destroy = [](void *data) { delete static_cast<int64_t *>(data); };
+	info.media_get_time = [](void *data) { return *static_cast<int64_t *>(data); };
+	info.media_set_time = [](void *data, int64_t ms) { *static_cast<int64_t *>(data) = ms; };
+	info.media_get_duration = [](void *) -> int64_t { return 600000; };
+	obs_register_source(&info);
+}
+
+void startup()
+{
+	base_set_log_handler(logHandler, nullptr);
+	if (!obs_startup("en-US", nullptr, nullptr)) qFatal("libobs could not be started.");
+
+	obs_audio_info audio_info = {48000, SPEAKERS_STEREO};
+	obs_reset_audio(&audio_info);
+
+	module_lookup = text_lookup_create(MMG_BENCH_LOCALE);
+	scratch_dir = new QTemporaryDir;
+
+	registerBenchSource();
+	bench_source = obs_source_create("mmg_bench_source", "Bench Source", nullptr, nullptr);
+	Frontend::init();
+
+	MMGEpoch::init();
+	global_config = new MMGConfig;
+	global_config->load(scratchPath("empty.json"));
+	global_config->finishLoad();
+	MMGActions::MMGFrameTransforms::init();
+}
+
+void shutdown()
+{
+	MMGActions::MMGFrameTransforms::release();
+	delete global_config;
+	global_config = nullptr;
+	MMGEpoch::release();
+
+	Frontend::release();
+	obs_source_release(bench_source);
+	bench_source = nullptr;
+
+	delete scratch_dir;
+	text_lookup_destroy(module_lookup);
+	obs_shutdown();
+}
+
+void processEvents()
+{
+	QCoreApplication::processEvents();
+}
+
+QString scratchPath(const QString &file_name)
+{
+	return scratch_dir->filePath(file_name);
+}
+
+const char *benchSourceUUID()
+{
+	return obs_source_get_uuid(bench_source);
+}
+
+void setMessageMode(bool midi2)
+{
+	for (MMGPreference *preference : *config()->preferences()) {
+		auto *midi = qobject_cast<MMGPreferences::MMGPreferenceMIDI *>(preference);
+		if (!midi) continue;
+
+		QJsonObject json_obj;
+		midi->json(json_obj);
+		MMGJson::setValue(json_obj, "message_mode",
+				  midi2 ? MMGPreferences::MMGPreferenceMIDI::MIDI_ALWAYS_2
+					: MMGPreferences::MMGPreferenceMIDI::MIDI_ALWAYS_1);
+		midi->load(json_obj);
+	}
+}
+
+QJsonObject binding(qsizetype i)
+{
+	QJsonObject message_obj;
+	message_obj["name"] = "Condition";
+	message_obj["id"] = 0x4090;
+	message_obj["device"] = "Bench";
+	message_obj["group"] = fixedValue<uint8_t>(1);
+	message_obj["channel"] = fixedValue<uint8_t>(uint8_t(i / 128 % 16 + 1));
+	message_obj["note"] = fixedValue<uint8_t>(uint8_t(i % 128));
+	message_obj["velocity"] = rangeValue<uint16_t>(0, 127, MMGStates::REFIDX_0);
+
+	QJsonObject action_obj;
+	action_obj["name"] = "Volume";
+	action_obj["id"] = 0x1301;
+	action_obj["source"] = fixedValue<MMGString>(benchSourceUUID());
+	action_obj["format"] = fixedValue<MMGString>("%");
+	action_obj["volume"] = rangeValue<float>(0.0f, 100.0f, MMGStates::REFIDX_3);
+
+	QJsonObject binding_obj;
+	binding_obj["name"] = QString("Binding %1").arg(i + 1);
+	binding_obj["enabled"] = true;
+	binding_obj["type"] = TYPE_INPUT;
+	binding_obj["reset_mode"] = MMGBinding::BINDING_TRIGGERED;
+	binding_obj["messages"] = QJsonArray {message_obj};
+	binding_obj["actions"] = QJsonArray {action_obj};
+	return binding_obj;
+}
+
+QJsonObject collection(const QString &name, qsizetype bindings)
+{
+	QJsonArray binding_arr;
+	for (qsizetype i = 0; i < bindings; ++i)
+		binding_arr += binding(i);
+
+	QJsonObject collection_obj;
+	collection_obj["name"] = name;
+	collection_obj["bindings"] = binding_arr;
+	return collection_obj;
+}
+
+QJsonObject configuration(qsizetype bindings)
+{
+	QJsonObject device_obj;
+	device_obj["name"] = "Bench";
+
+	QJsonObject config_obj;
+	config_obj["file_version"] = MMGConfig::currentFileVersion();
+	config_obj["devices"] = QJsonArray {device_obj};
+	config_obj["collections"] = QJsonArray {collection("Bench", bindings)};
+	return config_obj;
+}
+
+void loadConfiguration(qsizetype bindings, bool binary)
+{
+	QString path = scratchPath(QString("load-%1.%2").arg(bindings).arg(binary ? "cbor" : "json"));
+	if (!QFile::exists(path)) {
+		QJsonObject config_obj = configuration(bindings);
+
+		QFile file(path);
+		[[maybe_unused]] bool fileOpen = file.open(binary ? QFile::WriteOnly : QFile::WriteOnly | QFile::Text);
+		file.write(binary ? MMGJson::toBinary(config_obj) : MMGJson::toString(config_obj));
+	}
+
+	config()->load(path);
+	config()->finishLoad();
+	loaded_bindings = bindings;
+	processEvents();
+}
+
+void useConfiguration(qsizetype bindings)
+{
+	if (loaded_bindings != bindings) loadConfiguration(bindings);
+}
+
+MMGBindingManager *firstCollection()
+{
+	return config()->collections()->at(0);
+}
+
+} // namespace MMGBench
+
+int main(int argc, char **argv)
+{
+	// Widgets are only ever laid out, never shown
+	if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) qputenv("QT_QPA_PLATFORM", "offscreen");
+	QApplication app(argc, argv);
+
+	testing::InitGoogleTest(&argc, argv);
+	benchmark::Initialize(&argc, argv);
+
+	// Lets the tests run alone (as ctest does)
+	bool run_benchmarks = true;
+	for (int i = 1; i < argc; ++i) {
+		if (QByteArray(argv[i]) != "--no-benchmarks") continue;
+		run_benchmarks = false;
+		std::copy(argv + i + 1, argv + argc, argv + i);
+		--argc;
+		break;
+	}
+	if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+
+	MMGBench::startup();
+
+	int result = RUN_ALL_TESTS();
+	if (result == 0 && run_benchmarks) benchmark::RunSpecifiedBenchmarks();
+
+	benchmark::Shutdown();
+	MMGBench::shutdown();
+	return result;
+}
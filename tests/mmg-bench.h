@@ -0,0 +1,112 @@
+/*
+obs-midi-mg
+Copyright (C) 2022-2026 nhielost <nhielost@gmail.com>
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program. If not, see <https://www.gnu.org/licenses/>
+*/
+
+#ifndef MMG_BENCH_H
+#define MMG_BENCH_H
+
+#include "mmg-config.h"
+
+#include <QTemporaryDir>
+
+// The plugin runs here against libobs started headless (no video output or modules),
+// with the frontend API stood in for by obs-frontend-stub.cpp
+namespace MMGBench {
+
+void startup();
+void shutdown();
+
+// Runs everything queued for the main thread so far
+void processEvents();
+
+// A scratch directory that lasts as long as the harness
+QString scratchPath(const QString &file_name);
+
+// An audio and media source of the harness's own type, which remembers its volume and media time
+const char *benchSourceUUID();
+
+void setMessageMode(bool midi2);
+
+inline MMGMessageData midi1Message(uint8_t status, uint8_t channel, uint8_t data1, uint8_t data2)
+{
+	MMGMessageData message;
+	message.set<0, 4>(MMGMessages::MIDI1_CV);
+	message.set<8, 8>(status | ((channel - 1) & 0x0f));
+	message.set<16, 8>(data1 & 0x7f);
+	message.set<24, 8>(data2 & 0x7f);
+	return message;
+}
+
+// Values in the JSON layout that MMGValue reads
+template <typename T> inline QJsonObject fixedValue(const T &value)
+{
+	MMGValue<T> storage;
+	storage = value;
+
+	QJsonObject json_obj;
+	storage->json(json_obj, "value");
+	return json_obj["value"].toObject();
+}
+
+template <typename T> inline QJsonObject rangeValue(const T &min, const T &max, MMGStates::ReferenceIndex ref_index)
+{
+	MMGValue<T> storage;
+	auto *range = storage.template changeTo<STATE_RANGE>();
+	range->setMin(min);
+	range->setMax(max);
+	range->setReferenceIndex(ref_index);
+
+	QJsonObject json_obj;
+	storage->json(json_obj, "value");
+	return json_obj["value"].toObject();
+}
+
+template <typename T> inline QJsonObject incrementValue(const T &increment)
+{
+	MMGValue<T> storage;
+	storage.template changeTo<STATE_INCREMENT>()->setIncrement(increment);
+
+	QJsonObject json_obj;
+	storage->json(json_obj, "value");
+	return json_obj["value"].toObject();
+}
+
+// Synthetic configurations, in the same layout that MMGConfig::save writes.
+// Binding i listens for note (i % 128) on channel (i / 128 % 16 + 1) of the "Bench" device
+// (which has no port),
+// and maps the velocity onto the volume of the harness's source
+QJsonObject binding(qsizetype i);
+QJsonObject collection(const QString &name, qsizetype bindings);
+QJsonObject configuration(qsizetype bindings);
+
+// Replaces the configuration with a synthetic one of this many bindings, loaded as it would be from disk
+// (from CBOR if binary)
+void loadConfiguration(qsizetype bindings, bool binary = false);
+// The same, unless that configuration is already loaded
+void useConfiguration(qsizetype bindings);
+MMGBindingManager *firstCollection();
+
+} // namespace MMGBench
+
+namespace MMGBench::Frontend {
+
+void init();
+void release();
+
+} // namespace MMGBench::Frontend
+
+#endif // MMG_BENCH_H
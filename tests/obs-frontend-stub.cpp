@@ -0,0 +1,386 @@
+/*
+obs-midi-mg
+Copyright (C) 2022-2026 nhielost <nhielost@gmail.com>
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program. If not, see <https://www.gnu.org/licenses/>
+*/
+
+#include "mmg-bench.h"
+
+#include <QMainWindow>
+
+#include <util/config-file.h>
+
+// The parts of the OBS frontend that the plugin uses, kept in memory.
+// Outputs only flip their state and emit their events; nothing is ever encoded
+namespace MMGBench::Frontend {
+
+struct State {
+	QList<QPair<obs_frontend_event_cb, void *>> callbacks;
+
+	QList<obs_source_t *> scenes;
+	obs_source_t *current_scene = nullptr;
+	obs_source_t *preview_scene = nullptr;
+
+	QList<obs_source_t *> transitions;
+	obs_source_t *current_transition = nullptr;
+	int transition_duration = 300;
+	int tbar_position = 0;
+
+	QStringList collections {"Bench"};
+	QString current_collection = "Bench";
+	QStringList profiles {"Bench"};
+	QString current_profile = "Bench";
+	config_t *profile_config = nullptr;
+
+	bool streaming = false;
+	bool recording = false;
+	bool recording_paused = false;
+	bool replay_buffer = false;
+	bool virtualcam = false;
+	bool studio_mode = false;
+
+	QMainWindow *main_window = nullptr;
+};
+
+static State *state = nullptr;
+
+static void emitEvent(obs_frontend_event event)
+{
+	for (const auto &[callback, data] : QList(state->callbacks))
+		callback(event, data);
+}
+
+// Laid out like the frontend's own lists, so that a single bfree releases them
+static char **stringList(const QStringList &strings)
+{
+	QList<QByteArray> utf8;
+	size_t size = (strings.size() + 1) * sizeof(char *);
+	for (const QString &string : strings) {
+		utf8 += string.toUtf8();
+		size += utf8.last().size() + 1;
+	}
+
+	auto *list = static_cast<char **>(bzalloc(size));
+	char *data = reinterpret_cast<char *>(list + strings.size() + 1);
+	for (qsizetype i = 0; i < utf8.size(); ++i) {
+		list[i] = data;
+		memcpy(data, utf8[i].constData(), utf8[i].size() + 1);
+		data += utf8[i].size() + 1;
+	}
+	return list;
+}
+
+void init()
+{
+	state = new State;
+
+	for (const char *name : {"Scene", "Scene 2"})
+		state->scenes += obs_scene_get_source(obs_scene_create(name));
+	state->current_scene = state->scenes[0];
+	state->preview_scene = state->scenes[1];
+
+	for (const char *name : {"Fade", "Cut"})
+		state->transitions += obs_source_create_private("mmg_bench_source", name, nullptr);
+	state->current_transition = state->transitions[0];
+
+	config_open_string(&state->profile_config, "[Output]\nMode=Simple\n[SimpleOutput]\nRecRB=true\n");
+}
+
+void release()
+{
+	delete state->main_window;
+	config_close(state->profile_config);
+
+	for (obs_source_t *transition : state->transitions)
+		obs_source_release(transition);
+	for (obs_source_t *scene : state->scenes)
+		obs_source_release(scene);
+
+	delete state;
+	state = nullptr;
+}
+
+} // namespace MMGBench::Frontend
+
+using namespace MMGBench::Frontend;
+
+void *obs_frontend_get_main_window(void)
+{
+	if (!state->main_window) state->main_window = new QMainWindow;
+	return state->main_window;
+}
+
+const char *obs_frontend_get_locale_string(const char *string)
+{
+	return string;
+}
+
+void *obs_frontend_add_tools_menu_qaction(const char *name)
+{
+	auto *window = static_cast<QMainWindow *>(obs_frontend_get_main_window());
+	return window->addAction(name);
+}
+
+void obs_frontend_add_event_callback(obs_frontend_event_cb callback, void *private_data)
+{
+	state->callbacks += QPair(callback, private_data);
+}
+
+void obs_frontend_remove_event_callback(obs_frontend_event_cb callback, void *private_data)
+{
+	state->callbacks.removeOne(QPair(callback, private_data));
+}
+
+// Scenes
+char **obs_frontend_get_scene_names(void)
+{
+	QStringList names;
+	for (obs_source_t *scene : state->scenes)
+		names += obs_source_get_name(scene);
+	return stringList(names);
+}
+
+obs_source_t *obs_frontend_get_current_scene(void)
+{
+	return obs_source_get_ref(state->current_scene);
+}
+
+void obs_frontend_set_current_scene(obs_source_t *scene)
+{
+	if (!state->scenes.contains(scene)) return;
+
+	if (state->studio_mode) {
+		state->preview_scene = scene;
+		emitEvent(OBS_FRONTEND_EVENT_PREVIEW_SCENE_CHANGED);
+	} else {
+		state->current_scene = scene;
+		emitEvent(OBS_FRONTEND_EVENT_SCENE_CHANGED);
+	}
+}
+
+obs_source_t *obs_frontend_get_current_preview_scene(void)
+{
+	return state->studio_mode ? obs_source_get_ref(state->preview_scene) : nullptr;
+}
+
+void obs_frontend_set_current_preview_scene(obs_source_t *scene)
+{
+	if (!state->studio_mode || !state->scenes.contains(scene)) return;
+
+	state->preview_scene = scene;
+	emitEvent(OBS_FRONTEND_EVENT_PREVIEW_SCENE_CHANGED);
+}
+
+bool obs_frontend_preview_program_mode_active(void)
+{
+	return state->studio_mode;
+}
+
+void obs_frontend_set_preview_program_mode(bool enable)
+{
+	if (state->studio_mode == enable) return;
+
+	state->studio_mode = enable;
+	emitEvent(enable ? OBS_FRONTEND_EVENT_STUDIO_MODE_ENABLED : OBS_FRONTEND_EVENT_STUDIO_MODE_DISABLED);
+}
+
+void obs_frontend_take_screenshot(void) {}
+// End Scenes
+
+// Transitions
+void obs_frontend_get_transitions(obs_frontend_source_list *sources)
+{
+	// Each one is released by obs_frontend_source_list_free
+	for (obs_source_t *transition : state->transitions) {
+		obs_source_t *ref = obs_source_get_ref(transition);
+		da_push_back(sources->sources, &ref);
+	}
+}
+
+obs_source_t *obs_frontend_get_current_transition(void)
+{
+	return obs_source_get_ref(state->current_transition);
+}
+
+void obs_frontend_set_current_transition(obs_source_t *transition)
+{
+	if (!state->transitions.contains(transition)) return;
+
+	state->current_transition = transition;
+	emitEvent(OBS_FRONTEND_EVENT_TRANSITION_CHANGED);
+}
+
+int obs_frontend_get_transition_duration(void)
+{
+	return state->transition_duration;
+}
+
+void obs_frontend_set_transition_duration(int duration)
+{
+	state->transition_duration = duration;
+	emitEvent(OBS_FRONTEND_EVENT_TRANSITION_DURATION_CHANGED);
+}
+
+int obs_frontend_get_tbar_position(void)
+{
+	return state->tbar_position;
+}
+
+void obs_frontend_set_tbar_position(int position)
+{
+	state->tbar_position = position;
+}
+
+void obs_frontend_release_tbar(void)
+{
+	state->tbar_position = 0;
+	emitEvent(OBS_FRONTEND_EVENT_TBAR_VALUE_CHANGED);
+}
+// End Transitions
+
+// Collections and Profiles
+char **obs_frontend_get_scene_collections(void)
+{
+	return stringList(state->collections);
+}
+
+char *obs_frontend_get_current_scene_collection(void)
+{
+	return bstrdup(qUtf8Printable(state->current_collection));
+}
+
+void obs_frontend_set_current_scene_collection(const char *collection)
+{
+	if (!state->collections.contains(collection)) return;
+
+	state->current_collection = collection;
+	emitEvent(OBS_FRONTEND_EVENT_SCENE_COLLECTION_CHANGED);
+}
+
+char **obs_frontend_get_profiles(void)
+{
+	return stringList(state->profiles);
+}
+
+char *obs_frontend_get_current_profile(void)
+{
+	return bstrdup(qUtf8Printable(state->current_profile));
+}
+
+void obs_frontend_set_current_profile(const char *profile)
+{
+	if (!state->profiles.contains(profile)) return;
+
+	state->current_profile = profile;
+	emitEvent(OBS_FRONTEND_EVENT_PROFILE_CHANGED);
+}
+
+config_t *obs_frontend_get_profile_config(void)
+{
+	return state->profile_config;
+}
+// End Collections and Profiles
+
+// Outputs
+static void setOutput(bool &output, bool active, obs_frontend_event started, obs_frontend_event stopped)
+{
+	if (output == active) return;
+
+	output = active;
+	emitEvent(active ? started : stopped);
+}
+
+bool obs_frontend_streaming_active(void)
+{
+	return state->streaming;
+}
+
+void obs_frontend_streaming_start(void)
+{
+	setOutput(state->streaming, true, OBS_FRONTEND_EVENT_STREAMING_STARTED, OBS_FRONTEND_EVENT_STREAMING_STOPPED);
+}
+
+void obs_frontend_streaming_stop(void)
+{
+	setOutput(state->streaming, false, OBS_FRONTEND_EVENT_STREAMING_STARTED, OBS_FRONTEND_EVENT_STREAMING_STOPPED);
+}
+
+bool obs_frontend_recording_active(void)
+{
+	return state->recording;
+}
+
+void obs_frontend_recording_start(void)
+{
+	setOutput(state->recording, true, OBS_FRONTEND_EVENT_RECORDING_STARTED, OBS_FRONTEND_EVENT_RECORDING_STOPPED);
+}
+
+void obs_frontend_recording_stop(void)
+{
+	state->recording_paused = false;
+	setOutput(state->recording, false, OBS_FRONTEND_EVENT_RECORDING_STARTED, OBS_FRONTEND_EVENT_RECORDING_STOPPED);
+}
+
+bool obs_frontend_recording_paused(void)
+{
+	return state->recording_paused;
+}
+
+void obs_frontend_recording_pause(bool pause)
+{
+	if (!state->recording) return;
+	setOutput(state->recording_paused, pause, OBS_FRONTEND_EVENT_RECORDING_PAUSED,
+		  OBS_FRONTEND_EVENT_RECORDING_UNPAUSED);
+}
+
+bool obs_frontend_replay_buffer_active(void)
+{
+	return state->replay_buffer;
+}
+
+void obs_frontend_replay_buffer_start(void)
+{
+	setOutput(state->replay_buffer, true, OBS_FRONTEND_EVENT_REPLAY_BUFFER_STARTED,
+		  OBS_FRONTEND_EVENT_REPLAY_BUFFER_STOPPED);
+}
+
+void obs_frontend_replay_buffer_stop(void)
+{
+	setOutput(state->replay_buffer, false, OBS_FRONTEND_EVENT_REPLAY_BUFFER_STARTED,
+		  OBS_FRONTEND_EVENT_REPLAY_BUFFER_STOPPED);
+}
+
+void obs_frontend_replay_buffer_save(void)
+{
+	if (state->replay_buffer) emitEvent(OBS_FRONTEND_EVENT_REPLAY_BUFFER_SAVED);
+}
+
+bool obs_frontend_virtualcam_active(void)
+{
+	return state->virtualcam;
+}
+
+void obs_frontend_start_virtualcam(void)
+{
+	setOutput(state->virtualcam, true, OBS_FRONTEND_EVENT_VIRTUALCAM_STARTED,
+		  OBS_FRONTEND_EVENT_VIRTUALCAM_STOPPED);
+}
+
+void obs_frontend_stop_virtualcam(void)
+{
+	setOutput(state->virtualcam, false, OBS_FRONTEND_EVENT_VIRTUALCAM_STARTED,
+		  OBS_FRONTEND_EVENT_VIRTUALCAM_STOPPED);
+}
+// End Outputs